@@ -3,6 +3,168 @@
 // This file is part of the action_graph library and is licensed under the MIT
 // License. See the LICENSE file in the root directory for full license text.
 
+#include <action_graph/builder/builder.h>
+
+#include <chrono>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 namespace action_graph {
-namespace builder {} // namespace builder
+namespace builder {
+
+namespace {
+
+OverrunPolicy ParseOverrunPolicy(const ConfigurationNode &node) {
+  static const std::map<std::string, OverrunPolicy> kPolicies{
+      {"skip", OverrunPolicy::kSkip},
+      {"queue_one", OverrunPolicy::kQueueOne},
+      {"coalesce", OverrunPolicy::kCoalesce},
+      {"concurrent", OverrunPolicy::kRunConcurrently}};
+  const auto policy = kPolicies.find(node.AsString());
+  if (policy == kPolicies.end()) {
+    throw ConfigurationError("Unknown overrun_policy " + node.AsString() +
+                                 ". Expected skip, queue_one, coalesce or "
+                                 "concurrent.",
+                             node);
+  }
+  return policy->second;
+}
+
+CatchUpPolicy ParseCatchUpPolicy(const ConfigurationNode &node) {
+  static const std::map<std::string, CatchUpPolicy> kPolicies{
+      {"burst", CatchUpPolicy::kBurst},
+      {"skip_to_now", CatchUpPolicy::kSkipToNow},
+      {"limited_burst", CatchUpPolicy::kLimitedBurst}};
+  const auto policy = kPolicies.find(node.AsString());
+  if (policy == kPolicies.end()) {
+    throw ConfigurationError("Unknown catch_up_policy " + node.AsString() +
+                                 ". Expected burst, skip_to_now or "
+                                 "limited_burst.",
+                             node);
+  }
+  return policy->second;
+}
+
+std::size_t ParseCount(const ConfigurationNode &node,
+                       const std::string &key) {
+  const auto text = node.AsString();
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos)
+    throw ConfigurationError("Expected a non-negative number for " + key + ".",
+                             node);
+  try {
+    return std::stoul(text);
+  } catch (const std::out_of_range &) {
+    throw ConfigurationError("The number for " + key + " is out of range.",
+                             node);
+  }
+}
+
+executors::SchedulingPolicy
+ParseSchedulingPolicy(const ConfigurationNode &node) {
+  static const std::map<std::string, executors::SchedulingPolicy> kPolicies{
+      {"default", executors::SchedulingPolicy::kDefault},
+      {"fifo", executors::SchedulingPolicy::kFifo},
+      {"round_robin", executors::SchedulingPolicy::kRoundRobin}};
+  const auto policy = kPolicies.find(node.AsString());
+  if (policy == kPolicies.end()) {
+    throw ConfigurationError("Unknown scheduling_policy " + node.AsString() +
+                                 ". Expected default, fifo or round_robin.",
+                             node);
+  }
+  return policy->second;
+}
+
+std::vector<std::size_t> ParseCpuAffinity(const ConfigurationNode &node) {
+  if (!node.IsSequence())
+    return {ParseCount(node, "cpu_affinity")};
+  std::vector<std::size_t> cpus;
+  for (std::size_t index = 0; index < node.Size(); ++index) {
+    cpus.push_back(ParseCount(node.Get(index), "cpu_affinity"));
+  }
+  return cpus;
+}
+
+} // namespace
+
+std::size_t ParsePositiveCount(const ConfigurationNode &node,
+                               const std::string &key) {
+  const auto count = ParseCount(node, key);
+  if (count == 0)
+    throw ConfigurationError("Expected a positive number for " + key + ".",
+                             node);
+  return count;
+}
+
+executors::ThreadConfiguration
+ParseThreadConfiguration(const ConfigurationNode &thread) {
+  executors::ThreadConfiguration configuration;
+  if (thread.HasKey("name")) {
+    configuration.name = thread.Get("name").AsString();
+  }
+  if (thread.HasKey("cpu_affinity")) {
+    configuration.cpu_affinity = ParseCpuAffinity(thread.Get("cpu_affinity"));
+  }
+  if (thread.HasKey("scheduling_policy")) {
+    configuration.scheduling_policy =
+        ParseSchedulingPolicy(thread.Get("scheduling_policy"));
+  }
+  if (thread.HasKey("priority")) {
+    const auto &priority = thread.Get("priority");
+    const auto count = ParseCount(priority, "priority");
+    if (count > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+      throw ConfigurationError("The number for priority is out of range.",
+                               priority);
+    configuration.priority = static_cast<int>(count);
+  }
+  if (thread.HasKey("stack_size")) {
+    configuration.stack_size =
+        ParsePositiveCount(thread.Get("stack_size"), "stack_size");
+  }
+  return configuration;
+}
+
+TriggerOptions ParseTriggerOptions(const ConfigurationNode &trigger) {
+  TriggerOptions options;
+  options.name = trigger.Get("name").AsString();
+  if (trigger.HasKey("overrun_policy")) {
+    options.overrun_policy = ParseOverrunPolicy(trigger.Get("overrun_policy"));
+  }
+  if (trigger.HasKey("max_concurrent_executions")) {
+    options.max_concurrent_executions =
+        ParsePositiveCount(trigger.Get("max_concurrent_executions"),
+                           "max_concurrent_executions");
+  }
+  if (trigger.HasKey("phase")) {
+    options.phase = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        ParseDuration(trigger.Get("phase").AsString()));
+    options.has_phase = true;
+  }
+  if (trigger.HasKey("deadline")) {
+    options.deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        ParseDuration(trigger.Get("deadline").AsString()));
+  }
+  if (trigger.HasKey("tolerance")) {
+    options.tolerance = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        ParseDuration(trigger.Get("tolerance").AsString()));
+  }
+  if (trigger.HasKey("catch_up_policy")) {
+    options.catch_up_policy =
+        ParseCatchUpPolicy(trigger.Get("catch_up_policy"));
+  }
+  if (trigger.HasKey("max_catch_up_fires")) {
+    options.max_catch_up_fires =
+        ParsePositiveCount(trigger.Get("max_catch_up_fires"),
+                           "max_catch_up_fires");
+  }
+  if (trigger.HasKey("thread")) {
+    options.dedicated_thread = ParseThreadConfiguration(trigger.Get("thread"));
+    options.has_dedicated_thread = true;
+  }
+  return options;
+}
+
+} // namespace builder
 } // namespace action_graph
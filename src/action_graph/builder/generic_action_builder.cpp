@@ -6,9 +6,18 @@
 #include <action_graph/action_sequence.h>
 #include <action_graph/builder/configuration_node.h>
 #include <action_graph/builder/generic_action_builder.h>
+#include <action_graph/builder/parse_duration.h>
+#include <action_graph/dag_actions.h>
 #include <action_graph/parallel_actions.h>
 
+#include <chrono>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace action_graph {
 namespace builder {
@@ -61,7 +70,129 @@ void GenericActionBuilder::AddBuilderFunction(
   builder_functions_[action_type] = std::move(builder_function);
 }
 
-GenericActionBuilder CreateGenericActionBuilderWithDefaultActions() {
+namespace {
+
+// Reads the options of a parallel_actions node with mode team, e.g.
+//   mode: team
+//   spin: 50 microseconds
+//   thread:
+//     cpu_affinity: [2, 3, 4]
+executors::WorkerTeamOptions ParseTeamOptions(const ConfigurationNode &node) {
+  executors::WorkerTeamOptions options;
+  if (node.HasKey("spin")) {
+    options.spin_duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            ParseDuration(node.Get("spin").AsString()));
+  }
+  if (node.HasKey("thread")) {
+    options.member_threads = ParseThreadConfiguration(node.Get("thread"));
+  }
+  return options;
+}
+
+bool IsTeamMode(const ConfigurationNode &node) {
+  if (!node.HasKey("mode")) {
+    return false;
+  }
+  const auto mode = node.Get("mode").AsString();
+  if (mode != "team") {
+    throw ConfigurationError("Unknown mode " + mode + ". Expected team.",
+                             node);
+  }
+  return true;
+}
+
+std::unique_ptr<ParallelActions>
+CreateParallelActions(const ConfigurationNode &node,
+                      std::vector<ActionObject> actions,
+                      executors::Executor *parallel_executor) {
+  const auto name = node.Get("name").AsString();
+  if (IsTeamMode(node)) {
+    // the team runs every child on its members and does not schedule them
+    for (const auto *key : {"max_concurrency", "adaptive_threshold"}) {
+      if (node.HasKey(key)) {
+        throw ConfigurationError(std::string(key) +
+                                     " is not supported with mode team.",
+                                 node);
+      }
+    }
+    return std::make_unique<ParallelActions>(name, std::move(actions),
+                                             ParseTeamOptions(node));
+  }
+  if (parallel_executor == nullptr) {
+    return std::make_unique<ParallelActions>(name, std::move(actions));
+  }
+  return std::make_unique<ParallelActions>(name, std::move(actions),
+                                           *parallel_executor);
+}
+
+// Reads the names of the predecessors of an action of a dag_actions node,
+// either a single name or a sequence of names, e.g.
+//   depends_on: [load_assets, decode]
+std::vector<std::string> ParseDependsOn(const ConfigurationNode &action) {
+  if (!action.HasKey("depends_on")) {
+    return {};
+  }
+  const auto &depends_on = action.Get("depends_on");
+  if (depends_on.IsScalar()) {
+    return {depends_on.AsString()};
+  }
+  std::vector<std::string> names;
+  for (std::size_t index = 0; index < depends_on.Size(); ++index) {
+    names.push_back(depends_on.Get(index).AsString());
+  }
+  return names;
+}
+
+std::unique_ptr<DagActions>
+CreateDagActions(const ConfigurationNode &node,
+                 std::vector<ActionObject> actions,
+                 executors::Executor *parallel_executor) {
+  const auto &actions_node = node.Get("actions");
+  std::map<std::string, std::size_t> node_indices;
+  for (std::size_t index = 0; index < actions.size(); ++index) {
+    const auto &action = actions_node.Get(index).Get("action");
+    const auto action_name = action.Get("name").AsString();
+    if (!node_indices.emplace(action_name, index).second) {
+      throw ConfigurationError("The action name " + action_name +
+                                   " is not unique.",
+                               node);
+    }
+  }
+
+  std::vector<DagNode> nodes;
+  nodes.reserve(actions.size());
+  for (std::size_t index = 0; index < actions.size(); ++index) {
+    const auto &action = actions_node.Get(index).Get("action");
+    DagNode dag_node{std::move(actions[index]), {}};
+    for (const auto &predecessor : ParseDependsOn(action)) {
+      const auto found = node_indices.find(predecessor);
+      if (found == node_indices.end()) {
+        throw ConfigurationError("The action " +
+                                     action.Get("name").AsString() +
+                                     " depends on the unknown action " +
+                                     predecessor + ".",
+                                 node);
+      }
+      dag_node.depends_on.push_back(found->second);
+    }
+    nodes.push_back(std::move(dag_node));
+  }
+
+  const auto name = node.Get("name").AsString();
+  try {
+    if (parallel_executor == nullptr) {
+      return std::make_unique<DagActions>(name, std::move(nodes));
+    }
+    return std::make_unique<DagActions>(name, std::move(nodes),
+                                        *parallel_executor);
+  } catch (const std::invalid_argument &error) {
+    throw ConfigurationError(error.what(), node);
+  }
+}
+
+GenericActionBuilder
+CreateGenericActionBuilder(executors::Executor *parallel_executor) {
 
   GenericActionBuilder builder{};
 
@@ -74,13 +205,44 @@ GenericActionBuilder CreateGenericActionBuilderWithDefaultActions() {
       });
   builder.AddBuilderFunction(
       "parallel_actions",
-      [](const ConfigurationNode &node, const ActionBuilder &action_builder) {
-        auto actions = BuildActions(node, action_builder);
-        return std::make_unique<ParallelActions>(node.Get("name").AsString(),
-                                                 std::move(actions));
+      [parallel_executor](const ConfigurationNode &node,
+                          const ActionBuilder &action_builder) {
+        auto parallel_actions = CreateParallelActions(
+            node, BuildActions(node, action_builder), parallel_executor);
+        if (node.HasKey("adaptive_threshold")) {
+          AdaptiveGranularity granularity;
+          granularity.threshold =
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  ParseDuration(node.Get("adaptive_threshold").AsString()));
+          parallel_actions->SetAdaptiveGranularity(granularity);
+        }
+        if (node.HasKey("max_concurrency")) {
+          parallel_actions->SetMaxConcurrency(
+              ParsePositiveCount(node.Get("max_concurrency"),
+                                 "max_concurrency"));
+        }
+        return parallel_actions;
+      });
+  builder.AddBuilderFunction(
+      "dag_actions",
+      [parallel_executor](const ConfigurationNode &node,
+                          const ActionBuilder &action_builder) {
+        return CreateDagActions(node, BuildActions(node, action_builder),
+                                parallel_executor);
       });
   return builder;
 }
 
+} // namespace
+
+GenericActionBuilder CreateGenericActionBuilderWithDefaultActions() {
+  return CreateGenericActionBuilder(nullptr);
+}
+
+GenericActionBuilder
+CreateGenericActionBuilderWithDefaultActions(executors::Executor &executor) {
+  return CreateGenericActionBuilder(&executor);
+}
+
 } // namespace builder
 } // namespace action_graph
@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/compiler/execution_plan.h>
+
+#include <action_graph/action_sequence.h>
+#include <action_graph/decorators/decorated_action.h>
+#include <action_graph/parallel_actions.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace action_graph {
+namespace compiler {
+
+namespace {
+
+// The simplified tree, which is lowered into the plan.
+struct TreeNode {
+  enum class Kind { kLeaf, kSequence, kParallel };
+
+  Kind kind;
+  std::unique_ptr<Action> leaf;
+  std::vector<TreeNode> children;
+};
+
+TreeNode Simplify(std::unique_ptr<Action> action);
+
+// Merges children of the same kind into the parent.
+TreeNode SimplifyComposite(TreeNode::Kind kind,
+                           std::vector<std::unique_ptr<Action>> actions) {
+  TreeNode node{kind, nullptr, {}};
+  for (auto &action : actions) {
+    auto child = Simplify(std::move(action));
+    if (child.kind != kind) {
+      node.children.push_back(std::move(child));
+      continue;
+    }
+    std::move(child.children.begin(), child.children.end(),
+              std::back_inserter(node.children));
+  }
+  if (node.children.size() == 1) {
+    return std::move(node.children.front());
+  }
+  return node;
+}
+
+TreeNode Simplify(std::unique_ptr<Action> action) {
+  auto *decorated = dynamic_cast<decorators::DecoratedAction *>(action.get());
+  if (decorated != nullptr && decorated->IsNoOp()) {
+    return Simplify(decorated->ReleaseAction());
+  }
+  if (auto *sequence = dynamic_cast<ActionSequence *>(action.get())) {
+    return SimplifyComposite(TreeNode::Kind::kSequence,
+                             sequence->ReleaseActions());
+  }
+  if (auto *parallel = dynamic_cast<ParallelActions *>(action.get())) {
+    return SimplifyComposite(TreeNode::Kind::kParallel,
+                             parallel->ReleaseActions());
+  }
+  return TreeNode{TreeNode::Kind::kLeaf, std::move(action), {}};
+}
+
+using StepSet = std::vector<std::size_t>;
+
+// Appends consecutive leaves to the same step, as long as nothing has to run
+// in parallel to them.
+class PlanLowering {
+public:
+  explicit PlanLowering(ExecutionPlan &plan) : plan_(plan) {}
+
+  // Lowers node behind the steps in entry and returns the steps, which have
+  // to finish before the node is finished. The node may only continue the
+  // last step, if can_extend is set.
+  StepSet Lower(TreeNode &node, StepSet entry, bool can_extend) {
+    switch (node.kind) {
+    case TreeNode::Kind::kLeaf:
+      return LowerLeaf(std::move(node.leaf), std::move(entry), can_extend);
+    case TreeNode::Kind::kSequence:
+      for (auto &child : node.children) {
+        entry = Lower(child, std::move(entry), can_extend);
+        can_extend = true;
+      }
+      return entry;
+    case TreeNode::Kind::kParallel:
+    default:
+      return LowerParallel(node.children, std::move(entry));
+    }
+  }
+
+  // Converts the successor lists into the index ranges of the plan.
+  void LinkSteps() {
+    for (std::size_t step = 0; step < plan_.steps.size(); ++step) {
+      auto &plan_step = plan_.steps[step];
+      plan_step.first_successor = plan_.successors.size();
+      plan_step.successor_count = successor_lists_[step].size();
+      plan_.successors.insert(plan_.successors.end(),
+                              successor_lists_[step].begin(),
+                              successor_lists_[step].end());
+    }
+  }
+
+private:
+  StepSet LowerLeaf(std::unique_ptr<Action> leaf, StepSet entry,
+                    bool can_extend) {
+    if (!(can_extend && entry.size() == 1 && IsLastStepOpen(entry[0]))) {
+      entry = {AddStep(entry)};
+    }
+    plan_.actions.push_back(std::move(leaf));
+    ++plan_.steps.back().action_count;
+    return entry;
+  }
+
+  StepSet LowerParallel(std::vector<TreeNode> &children, StepSet entry) {
+    // like an empty sequence, so that the next node still follows the entry
+    if (children.empty()) {
+      return entry;
+    }
+    // joins the entry once instead of linking every entry step to every child
+    if (entry.size() > 1 && children.size() > 1) {
+      entry = {AddStep(entry)};
+    }
+    StepSet exit;
+    for (auto &child : children) {
+      const auto child_exit = Lower(child, entry, false);
+      exit.insert(exit.end(), child_exit.begin(), child_exit.end());
+    }
+    std::sort(exit.begin(), exit.end());
+    exit.erase(std::unique(exit.begin(), exit.end()), exit.end());
+    return exit;
+  }
+
+  // The last step is open, as long as its actions are the last ones and no
+  // other step was added after it.
+  bool IsLastStepOpen(std::size_t step) const {
+    if (step + 1 != plan_.steps.size()) {
+      return false;
+    }
+    const auto &last = plan_.steps.back();
+    return last.first_action + last.action_count == plan_.actions.size();
+  }
+
+  std::size_t AddStep(const StepSet &predecessors) {
+    const auto step = plan_.steps.size();
+    plan_.steps.push_back(
+        PlanStep{plan_.actions.size(), 0, 0, 0, predecessors.size()});
+    successor_lists_.emplace_back();
+    for (const auto predecessor : predecessors) {
+      successor_lists_[predecessor].push_back(step);
+    }
+    return step;
+  }
+
+  ExecutionPlan &plan_;
+  std::vector<StepSet> successor_lists_{};
+};
+
+} // namespace
+
+ExecutionPlan CompilePlan(std::unique_ptr<Action> action) {
+  ExecutionPlan plan{};
+  plan.name = action->name;
+  auto tree = Simplify(std::move(action));
+  PlanLowering lowering{plan};
+  lowering.Lower(tree, {}, true);
+  lowering.LinkSteps();
+  return plan;
+}
+
+} // namespace compiler
+} // namespace action_graph
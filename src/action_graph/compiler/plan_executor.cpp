@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/compiler/plan_executor.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace action_graph {
+namespace compiler {
+
+namespace {
+
+// Runs the actions of a step, which are stored next to each other.
+class StepAction final : public Action {
+public:
+  StepAction(std::string name, const std::unique_ptr<Action> *first_action,
+             std::size_t action_count)
+      : Action(std::move(name)), first_action_(first_action),
+        action_count_(action_count) {}
+
+  void Execute() override {
+    for (std::size_t action = 0; action < action_count_; ++action) {
+      first_action_[action]->Execute();
+    }
+  }
+
+private:
+  const std::unique_ptr<Action> *const first_action_;
+  const std::size_t action_count_;
+};
+
+} // namespace
+
+PlanExecutor::PlanExecutor(ExecutionPlan plan)
+    : Action(plan.name), plan_(std::move(plan)) {
+  if (plan_.steps.size() > 1) {
+    steps_ = std::make_unique<DagActions>(name, CreateStepNodes());
+  }
+}
+
+PlanExecutor::PlanExecutor(ExecutionPlan plan, executors::Executor &executor)
+    : Action(plan.name), plan_(std::move(plan)) {
+  if (plan_.steps.size() > 1) {
+    steps_ = std::make_unique<DagActions>(name, CreateStepNodes(), executor);
+  }
+}
+
+void PlanExecutor::Execute() {
+  if (steps_) {
+    steps_->Execute();
+    return;
+  }
+  for (auto &action : plan_.actions) {
+    action->Execute();
+  }
+}
+
+const ExecutionPlan &PlanExecutor::GetPlan() const noexcept { return plan_; }
+
+std::vector<DagNode> PlanExecutor::CreateStepNodes() {
+  std::vector<DagNode> nodes;
+  nodes.reserve(plan_.steps.size());
+  for (std::size_t step = 0; step < plan_.steps.size(); ++step) {
+    const auto &plan_step = plan_.steps[step];
+    nodes.push_back(DagNode{std::make_unique<StepAction>(
+                                name + " step " + std::to_string(step),
+                                plan_.actions.data() + plan_step.first_action,
+                                plan_step.action_count),
+                            {}});
+    nodes.back().depends_on.reserve(plan_step.predecessor_count);
+  }
+  for (std::size_t step = 0; step < plan_.steps.size(); ++step) {
+    const auto &plan_step = plan_.steps[step];
+    for (auto index = plan_step.first_successor;
+         index < plan_step.first_successor + plan_step.successor_count;
+         ++index) {
+      nodes[plan_.successors[index]].depends_on.push_back(step);
+    }
+  }
+  return nodes;
+}
+
+} // namespace compiler
+} // namespace action_graph
@@ -0,0 +1,269 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/dag_actions.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace action_graph {
+
+DagActions::DagActions(std::string name, std::vector<DagNode> nodes)
+    : DagActions(std::move(name), std::move(nodes),
+                 thread_per_task_executor_) {}
+
+DagActions::DagActions(std::string name, std::vector<DagNode> nodes,
+                       executors::Executor &executor)
+    : Action(std::move(name)), nodes_(std::move(nodes)), executor_(executor) {
+  LinkSuccessors();
+  ThrowOnCycle();
+  states_.push_back(std::make_unique<ExecutionState>(nodes_.size()));
+  free_states_.push_back(states_.back().get());
+}
+
+DagActions::~DagActions() {
+  std::unique_lock<std::mutex> lock(state_mutex_);
+  state_changed_.wait(lock, [this]() {
+    return std::all_of(states_.begin(), states_.end(),
+                       [](const std::unique_ptr<ExecutionState> &state) {
+                         return state->helpers_in_flight == 0;
+                       });
+  });
+}
+
+DagActions::ExecutionState::ExecutionState(std::size_t node_count)
+    : unfinished_predecessors(
+          std::make_unique<std::atomic<std::size_t>[]>(node_count)),
+      node_exceptions(node_count), ready_nodes(node_count) {}
+
+void DagActions::Execute() {
+  if (nodes_.empty()) {
+    return;
+  }
+  auto &state = AcquireState();
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    for (std::size_t node = 0; node < nodes_.size(); ++node) {
+      state.unfinished_predecessors[node] = nodes_[node].depends_on.size();
+    }
+    std::copy(roots_.begin(), roots_.end(), state.ready_nodes.begin());
+    state.next_ready_node = 0;
+    state.ready_node_end = roots_.size();
+    state.unfinished_nodes = nodes_.size();
+    state.is_failed = false;
+  }
+  PostHelpers(state, roots_.size() - 1);
+
+  // The executing thread runs ready nodes until every node finished.
+  while (true) {
+    std::size_t node = 0;
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      state_changed_.wait(lock, [&state]() {
+        return state.next_ready_node != state.ready_node_end ||
+               state.unfinished_nodes == 0;
+      });
+      if (state.next_ready_node == state.ready_node_end) {
+        break;
+      }
+      node = state.ready_nodes[state.next_ready_node++];
+    }
+    RunNode(state, node);
+  }
+  const auto exception = TakeFirstException(state);
+  ReleaseState(state);
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void DagActions::LinkSuccessors() {
+  const auto node_count = nodes_.size();
+  successor_begins_.assign(node_count + 1, 0);
+  for (std::size_t node = 0; node < node_count; ++node) {
+    const auto &depends_on = nodes_[node].depends_on;
+    for (const auto predecessor : depends_on) {
+      if (predecessor >= node_count) {
+        throw std::invalid_argument("A node of " + name +
+                                    " depends on the unknown node " +
+                                    std::to_string(predecessor) + ".");
+      }
+      ++successor_begins_[predecessor + 1];
+    }
+    if (depends_on.empty()) {
+      roots_.push_back(node);
+    }
+  }
+  std::partial_sum(successor_begins_.begin(), successor_begins_.end(),
+                   successor_begins_.begin());
+
+  successors_.resize(successor_begins_.back());
+  auto successor_ends = successor_begins_;
+  for (std::size_t node = 0; node < node_count; ++node) {
+    for (const auto predecessor : nodes_[node].depends_on) {
+      successors_[successor_ends[predecessor]++] = node;
+    }
+  }
+}
+
+// Removes the roots from the graph until no node is left. The nodes, which
+// are never removed, are part of a cycle or depend on one.
+void DagActions::ThrowOnCycle() const {
+  std::vector<std::size_t> unfinished_predecessors;
+  unfinished_predecessors.reserve(nodes_.size());
+  for (const auto &node : nodes_) {
+    unfinished_predecessors.push_back(node.depends_on.size());
+  }
+  auto ready_nodes = roots_;
+  std::size_t removed_nodes = 0;
+  while (!ready_nodes.empty()) {
+    const auto node = ready_nodes.back();
+    ready_nodes.pop_back();
+    ++removed_nodes;
+    for (auto index = successor_begins_[node];
+         index < successor_begins_[node + 1]; ++index) {
+      if (--unfinished_predecessors[successors_[index]] == 0) {
+        ready_nodes.push_back(successors_[index]);
+      }
+    }
+  }
+  if (removed_nodes != nodes_.size()) {
+    throw std::invalid_argument("The dependencies of " + name +
+                                " contain a cycle.");
+  }
+}
+
+// Reuses a free state or, while all states are in use by concurrent
+// executions, adds another one.
+DagActions::ExecutionState &DagActions::AcquireState() {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (free_states_.empty()) {
+    states_.push_back(std::make_unique<ExecutionState>(nodes_.size()));
+    // so that releasing a state never allocates
+    free_states_.reserve(states_.size());
+    return *states_.back();
+  }
+  auto &state = *free_states_.back();
+  free_states_.pop_back();
+  return state;
+}
+
+void DagActions::ReleaseState(ExecutionState &state) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  free_states_.push_back(&state);
+}
+
+// A helper is counted before it is posted, so that it cannot count down
+// first. If posting fails, the executing thread runs the ready nodes, which
+// are left, and skips them like after an exception of a node.
+void DagActions::PostHelpers(ExecutionState &state, std::size_t helper_count) {
+  for (std::size_t helper = 0; helper < helper_count; ++helper) {
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      ++state.helpers_in_flight;
+    }
+    try {
+      executor_.Post([this, &state]() { RunHelper(state); });
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      --state.helpers_in_flight;
+      if (!state.post_exception) {
+        state.post_exception = std::current_exception();
+      }
+      state.is_failed = true;
+      state_changed_.notify_all();
+      return;
+    }
+  }
+}
+
+// A helper, which starts after its Execute returned, takes part in the next
+// execution with the same state or finds no node to run.
+void DagActions::RunHelper(ExecutionState &state) {
+  std::size_t node = 0;
+  while (TryClaimReadyNode(state, node)) {
+    RunNode(state, node);
+  }
+  // under the lock, so that the destructor cannot finish before
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (--state.helpers_in_flight == 0) {
+    state_changed_.notify_all();
+  }
+}
+
+bool DagActions::TryClaimReadyNode(ExecutionState &state, std::size_t &node) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (state.next_ready_node == state.ready_node_end) {
+    return false;
+  }
+  node = state.ready_nodes[state.next_ready_node++];
+  return true;
+}
+
+void DagActions::RunNode(ExecutionState &state, std::size_t node) {
+  if (!state.is_failed.load()) {
+    try {
+      nodes_[node].action->Execute();
+    } catch (...) {
+      state.node_exceptions[node] = std::current_exception();
+      state.is_failed = true;
+    }
+  }
+  ReleaseSuccessors(state, node);
+}
+
+// The thread, which finished the last predecessor of a node, makes it ready.
+// It runs one of the new ready nodes itself and posts a helper for each of
+// the others. The node counts as finished only after the helpers are posted,
+// so that the execution cannot end while this thread still posts.
+void DagActions::ReleaseSuccessors(ExecutionState &state, std::size_t node) {
+  std::size_t new_ready_nodes = 0;
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_, std::defer_lock);
+    for (auto index = successor_begins_[node];
+         index < successor_begins_[node + 1]; ++index) {
+      const auto successor = successors_[index];
+      if (--state.unfinished_predecessors[successor] != 0) {
+        continue;
+      }
+      if (!lock.owns_lock()) {
+        lock.lock();
+      }
+      state.ready_nodes[state.ready_node_end++] = successor;
+      ++new_ready_nodes;
+    }
+    if (new_ready_nodes > 0) {
+      state_changed_.notify_all();
+    }
+  }
+  if (new_ready_nodes > 1) {
+    PostHelpers(state, new_ready_nodes - 1);
+  }
+  FinishNode(state);
+}
+
+void DagActions::FinishNode(ExecutionState &state) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (--state.unfinished_nodes == 0) {
+    state_changed_.notify_all();
+  }
+}
+
+std::exception_ptr DagActions::TakeFirstException(ExecutionState &state) {
+  auto &exceptions = state.node_exceptions;
+  const auto first = std::find_if(exceptions.begin(), exceptions.end(),
+                                  [](const std::exception_ptr &exception) {
+                                    return static_cast<bool>(exception);
+                                  });
+  auto exception = first != exceptions.end() ? *first : state.post_exception;
+  std::fill(exceptions.begin(), exceptions.end(), nullptr);
+  state.post_exception = nullptr;
+  return exception;
+}
+
+} // namespace action_graph
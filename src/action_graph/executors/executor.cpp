@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/executor.h>
+
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace action_graph {
+namespace executors {
+
+void InlineExecutor::Post(std::function<void()> task) { task(); }
+
+void InlineExecutor::Post(std::function<void()> task,
+                          std::chrono::nanoseconds /*deadline*/) {
+  task();
+}
+
+void InlineExecutor::RunAll(std::size_t count,
+                            const std::function<void(std::size_t)> &task) {
+  for (std::size_t index = 0; index < count; ++index) {
+    task(index);
+  }
+}
+
+void ThreadPerTaskExecutor::Post(std::function<void()> task) {
+  std::thread(std::move(task)).detach();
+}
+
+void ThreadPerTaskExecutor::Post(std::function<void()> task,
+                                 std::chrono::nanoseconds /*deadline*/) {
+  Post(std::move(task));
+}
+
+void ThreadPerTaskExecutor::RunAll(
+    std::size_t count, const std::function<void(std::size_t)> &task) {
+  std::vector<std::future<void>> futures;
+  futures.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    futures.push_back(
+        std::async(std::launch::async, [&task, index]() { task(index); }));
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+}
+
+} // namespace executors
+} // namespace action_graph
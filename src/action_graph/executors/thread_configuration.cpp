@@ -0,0 +1,187 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_configuration.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#ifdef __linux__
+#include <climits>
+#include <sched.h>
+#endif
+
+namespace action_graph {
+namespace executors {
+
+namespace {
+
+struct ThreadStart {
+  ThreadConfiguration configuration;
+  std::function<void()> function;
+  std::promise<bool> is_configuration_applied{};
+};
+
+void Run(std::unique_ptr<ThreadStart> start) {
+  start->is_configuration_applied.set_value(
+      ApplyToCurrentThread(start->configuration));
+  auto function = std::move(start->function);
+  start.reset();
+  function();
+}
+
+#ifdef __linux__
+constexpr std::size_t kMaximumNameLength = 15;
+
+void *RunThread(void *argument) {
+  Run(std::unique_ptr<ThreadStart>(static_cast<ThreadStart *>(argument)));
+  return nullptr;
+}
+
+bool SetAffinity(pthread_t thread, const std::vector<std::size_t> &cpus) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE)
+      return false;
+    CPU_SET(cpu, &cpu_set);
+  }
+  return pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set) == 0;
+}
+
+bool SetSchedulingPolicy(pthread_t thread, SchedulingPolicy scheduling_policy,
+                         int priority) {
+  const int policy =
+      scheduling_policy == SchedulingPolicy::kFifo ? SCHED_FIFO : SCHED_RR;
+  sched_param parameter{};
+  parameter.sched_priority =
+      std::min(std::max(priority, sched_get_priority_min(policy)),
+               sched_get_priority_max(policy));
+  return pthread_setschedparam(thread, policy, &parameter) == 0;
+}
+#endif
+
+} // namespace
+
+bool ApplyToCurrentThread(const ThreadConfiguration &configuration) {
+#ifdef __linux__
+  bool is_applied = true;
+  const auto self = pthread_self();
+  if (!configuration.name.empty()) {
+    const auto name = configuration.name.substr(0, kMaximumNameLength);
+    is_applied = pthread_setname_np(self, name.c_str()) == 0 && is_applied;
+  }
+  if (!configuration.cpu_affinity.empty()) {
+    is_applied = SetAffinity(self, configuration.cpu_affinity) && is_applied;
+  }
+  if (configuration.scheduling_policy != SchedulingPolicy::kDefault) {
+    is_applied = SetSchedulingPolicy(self, configuration.scheduling_policy,
+                                     configuration.priority) &&
+                 is_applied;
+  }
+  return is_applied;
+#else
+  return configuration.name.empty() && configuration.cpu_affinity.empty() &&
+         configuration.scheduling_policy == SchedulingPolicy::kDefault;
+#endif
+}
+
+ConfiguredThread::ConfiguredThread(const ThreadConfiguration &configuration,
+                                   std::function<void()> function) {
+  std::unique_ptr<ThreadStart> start(
+      new ThreadStart{configuration, std::move(function)});
+  auto is_configuration_applied =
+      start->is_configuration_applied.get_future().share();
+#ifdef __linux__
+  pthread_attr_t attributes;
+  pthread_attr_init(&attributes);
+  if (configuration.stack_size > 0) {
+    pthread_attr_setstacksize(
+        &attributes, std::max<std::size_t>(configuration.stack_size,
+                                           PTHREAD_STACK_MIN));
+  }
+  const int result =
+      pthread_create(&handle_, &attributes, RunThread, start.get());
+  pthread_attr_destroy(&attributes);
+  if (result != 0) {
+    throw std::system_error(result, std::generic_category(),
+                            "Could not start thread");
+  }
+  start.release();
+  is_joinable_ = true;
+#else
+  thread_ = std::thread(
+      [](std::unique_ptr<ThreadStart> start) { Run(std::move(start)); },
+      std::move(start));
+#endif
+  is_configuration_applied_ = std::move(is_configuration_applied);
+}
+
+bool ConfiguredThread::IsConfigurationApplied() const {
+  if (!is_configuration_applied_.valid())
+    throw std::logic_error("The thread was not started.");
+  return is_configuration_applied_.get();
+}
+
+#ifdef __linux__
+ConfiguredThread::ConfiguredThread(ConfiguredThread &&other) noexcept
+    : handle_(other.handle_), is_joinable_(other.is_joinable_),
+      is_configuration_applied_(std::move(other.is_configuration_applied_)) {
+  other.is_joinable_ = false;
+}
+
+ConfiguredThread &
+ConfiguredThread::operator=(ConfiguredThread &&other) noexcept {
+  if (this != &other) {
+    if (is_joinable_)
+      Join();
+    handle_ = other.handle_;
+    is_joinable_ = other.is_joinable_;
+    other.is_joinable_ = false;
+    is_configuration_applied_ = std::move(other.is_configuration_applied_);
+  }
+  return *this;
+}
+
+bool ConfiguredThread::Joinable() const noexcept { return is_joinable_; }
+
+void ConfiguredThread::Join() {
+  if (!is_joinable_)
+    throw std::logic_error("The thread is not joinable.");
+  pthread_join(handle_, nullptr);
+  is_joinable_ = false;
+}
+#else
+ConfiguredThread::ConfiguredThread(ConfiguredThread &&other) noexcept
+    : thread_(std::move(other.thread_)),
+      is_configuration_applied_(std::move(other.is_configuration_applied_)) {}
+
+ConfiguredThread &
+ConfiguredThread::operator=(ConfiguredThread &&other) noexcept {
+  if (this != &other) {
+    if (thread_.joinable())
+      thread_.join();
+    thread_ = std::move(other.thread_);
+    is_configuration_applied_ = std::move(other.is_configuration_applied_);
+  }
+  return *this;
+}
+
+bool ConfiguredThread::Joinable() const noexcept { return thread_.joinable(); }
+
+void ConfiguredThread::Join() { thread_.join(); }
+#endif
+
+ConfiguredThread::~ConfiguredThread() {
+  if (Joinable())
+    Join();
+}
+
+} // namespace executors
+} // namespace action_graph
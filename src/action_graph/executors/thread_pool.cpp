@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace action_graph {
+namespace executors {
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+    : ThreadPool(thread_count, ThreadConfiguration{}) {}
+
+ThreadPool::ThreadPool(std::size_t thread_count,
+                       ThreadConfiguration configuration) {
+  if (thread_count == 0) {
+    throw std::invalid_argument("A ThreadPool needs at least one thread.");
+  }
+  const auto name = configuration.name;
+  workers_.reserve(thread_count);
+  for (std::size_t index = 0; index < thread_count; ++index) {
+    if (!name.empty() && thread_count > 1) {
+      configuration.name = name + std::to_string(index);
+    }
+    workers_.emplace_back(configuration, [this]() { WorkerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    is_stopping_ = true;
+  }
+  task_available_.notify_all();
+  for (auto &worker : workers_) {
+    worker.Join();
+  }
+}
+
+void ThreadPool::Post(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    PushTask(std::move(task));
+  }
+  task_available_.notify_one();
+}
+
+void ThreadPool::Post(std::function<void()> task,
+                      std::chrono::nanoseconds deadline) {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    deadline_tasks_.push_back(
+        DeadlineTask{deadline, posted_deadline_tasks_++, std::move(task)});
+    std::push_heap(deadline_tasks_.begin(), deadline_tasks_.end(), IsLater);
+  }
+  task_available_.notify_one();
+}
+
+void ThreadPool::RunAll(std::size_t count,
+                        const std::function<void(std::size_t)> &task) {
+  if (count == 0) {
+    return;
+  }
+  // shared with the helpers, which may start after RunAll returned
+  struct Calls {
+    std::atomic<std::size_t> next_index{0};
+    std::mutex mutex{};
+    std::condition_variable finished{};
+    std::size_t finished_count{0};
+    std::exception_ptr exception{};
+  };
+  auto calls = std::make_shared<Calls>();
+  const auto run_unclaimed_calls = [calls, &task, count]() {
+    for (auto index = calls->next_index++; index < count;
+         index = calls->next_index++) {
+      std::exception_ptr exception;
+      try {
+        task(index);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(calls->mutex);
+      if (exception && !calls->exception) {
+        calls->exception = exception;
+      }
+      if (++calls->finished_count == count) {
+        calls->finished.notify_all();
+      }
+    }
+  };
+  const auto helper_count = std::min(count, workers_.size() + 1) - 1;
+  for (std::size_t helper = 0; helper < helper_count; ++helper) {
+    Post(run_unclaimed_calls);
+  }
+  run_unclaimed_calls();
+  std::unique_lock<std::mutex> lock(calls->mutex);
+  calls->finished.wait(
+      lock, [&calls, count]() { return calls->finished_count == count; });
+  if (calls->exception) {
+    std::rethrow_exception(calls->exception);
+  }
+}
+
+std::size_t ThreadPool::ThreadCount() const noexcept {
+  return workers_.size();
+}
+
+bool ThreadPool::AreWorkersConfigured() const {
+  return std::all_of(workers_.begin(), workers_.end(),
+                     [](const ConfiguredThread &worker) {
+                       return worker.IsConfigurationApplied();
+                     });
+}
+
+std::size_t ThreadPool::DefaultThreadCount() noexcept {
+  constexpr std::size_t kMinimumThreadCount = 2;
+  return std::max<std::size_t>(std::thread::hardware_concurrency(),
+                               kMinimumThreadCount);
+}
+
+bool ThreadPool::IsLater(const DeadlineTask &lhs, const DeadlineTask &rhs) {
+  if (lhs.deadline != rhs.deadline)
+    return lhs.deadline > rhs.deadline;
+  return lhs.sequence > rhs.sequence;
+}
+
+void ThreadPool::PushTask(std::function<void()> task) {
+  if (task_count_ == tasks_.size()) {
+    constexpr std::size_t kInitialCapacity = 16;
+    std::vector<std::function<void()>> grown(
+        std::max(kInitialCapacity, 2 * tasks_.size()));
+    for (std::size_t index = 0; index < task_count_; ++index) {
+      grown[index] = std::move(tasks_[(first_task_ + index) % tasks_.size()]);
+    }
+    tasks_ = std::move(grown);
+    first_task_ = 0;
+  }
+  tasks_[(first_task_ + task_count_) % tasks_.size()] = std::move(task);
+  ++task_count_;
+}
+
+std::function<void()> ThreadPool::TakeNextTask() {
+  std::function<void()> task;
+  if (!deadline_tasks_.empty()) {
+    std::pop_heap(deadline_tasks_.begin(), deadline_tasks_.end(), IsLater);
+    task = std::move(deadline_tasks_.back().task);
+    deadline_tasks_.pop_back();
+  } else {
+    task = std::move(tasks_[first_task_]);
+    tasks_[first_task_] = nullptr;
+    first_task_ = (first_task_ + 1) % tasks_.size();
+    --task_count_;
+  }
+  return task;
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(tasks_mutex_);
+      task_available_.wait(lock, [this]() {
+        return is_stopping_ || task_count_ > 0 || !deadline_tasks_.empty();
+      });
+      if (task_count_ == 0 && deadline_tasks_.empty()) {
+        return;
+      }
+      task = TakeNextTask();
+    }
+    task();
+  }
+}
+
+} // namespace executors
+} // namespace action_graph
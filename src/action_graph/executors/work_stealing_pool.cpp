@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/work_stealing_pool.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace action_graph {
+namespace executors {
+
+namespace {
+
+struct CurrentWorker {
+  const WorkStealingPool *pool;
+  std::size_t index;
+};
+
+thread_local CurrentWorker current_worker{nullptr, 0};
+
+// Rounds of searching before an idle thread goes to sleep.
+constexpr int kSearchRounds = 64;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(std::size_t thread_count)
+    : WorkStealingPool(thread_count, ThreadConfiguration{}) {}
+
+WorkStealingPool::WorkStealingPool(std::size_t thread_count,
+                                   ThreadConfiguration configuration) {
+  if (thread_count == 0) {
+    throw std::invalid_argument(
+        "A WorkStealingPool needs at least one thread.");
+  }
+  workers_.reserve(thread_count);
+  for (std::size_t index = 0; index < thread_count; ++index) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  const auto name = configuration.name;
+  for (std::size_t index = 0; index < thread_count; ++index) {
+    if (!name.empty() && thread_count > 1) {
+      configuration.name = name + std::to_string(index);
+    }
+    workers_[index]->thread =
+        ConfiguredThread(configuration, [this, index]() { WorkerLoop(index); });
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  is_stopping_ = true;
+  NotifyWork(true);
+  for (auto &worker : workers_) {
+    worker->thread.Join();
+  }
+}
+
+void WorkStealingPool::Submit(TaskGroup &group, std::function<void()> task) {
+  ++group.pending_tasks_;
+  Push(new Task{std::move(task), &group});
+}
+
+void WorkStealingPool::Post(std::function<void()> task) {
+  Push(new Task{std::move(task), nullptr});
+}
+
+void WorkStealingPool::Post(std::function<void()> task,
+                            std::chrono::nanoseconds /*deadline*/) {
+  Post(std::move(task));
+}
+
+void WorkStealingPool::RunAll(std::size_t count,
+                              const std::function<void(std::size_t)> &task) {
+  TaskGroup group;
+  for (std::size_t index = 0; index < count; ++index) {
+    Submit(group, [&task, index]() { task(index); });
+  }
+  Wait(group);
+}
+
+void WorkStealingPool::Wait(TaskGroup &group) {
+  const auto worker_index = CurrentWorkerIndex();
+  const auto is_finished = [&group]() {
+    return group.pending_tasks_.load() == 0;
+  };
+  int idle_rounds = 0;
+  while (!is_finished()) {
+    const auto seen_epoch = work_epoch_.load();
+    auto *task = FindTask(worker_index);
+    if (task != nullptr) {
+      Execute(task);
+      idle_rounds = 0;
+    } else if (++idle_rounds < kSearchRounds) {
+      std::this_thread::yield();
+    } else {
+      SleepUnlessChanged(seen_epoch, is_finished);
+    }
+  }
+  std::lock_guard<std::mutex> lock(group.exception_mutex_);
+  if (group.exception_) {
+    auto exception = group.exception_;
+    group.exception_ = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+std::size_t WorkStealingPool::ThreadCount() const noexcept {
+  return workers_.size();
+}
+
+void WorkStealingPool::WorkerLoop(std::size_t index) {
+  current_worker = CurrentWorker{this, index};
+  int idle_rounds = 0;
+  while (true) {
+    const auto seen_epoch = work_epoch_.load();
+    auto *task = FindTask(index);
+    if (task != nullptr) {
+      Execute(task);
+      idle_rounds = 0;
+    } else if (is_stopping_) {
+      return;
+    } else if (++idle_rounds < kSearchRounds) {
+      std::this_thread::yield();
+    } else {
+      SleepUnlessChanged(seen_epoch, [this]() { return is_stopping_.load(); });
+    }
+  }
+}
+
+std::size_t WorkStealingPool::CurrentWorkerIndex() const noexcept {
+  return current_worker.pool == this ? current_worker.index : workers_.size();
+}
+
+WorkStealingPool::Task *WorkStealingPool::FindTask(std::size_t worker_index) {
+  const auto worker_count = workers_.size();
+  if (worker_index < worker_count) {
+    auto *task = workers_[worker_index]->deque.Pop();
+    if (task != nullptr)
+      return task;
+  }
+  auto *task = TakeInjectedTask();
+  if (task != nullptr)
+    return task;
+  // starts with the next worker, so that the thieves spread across victims
+  const auto first_victim = worker_index + 1;
+  for (std::size_t offset = 0; offset < worker_count; ++offset) {
+    const auto victim = (first_victim + offset) % worker_count;
+    if (victim == worker_index)
+      continue;
+    task = workers_[victim]->deque.Steal();
+    if (task != nullptr)
+      return task;
+  }
+  return nullptr;
+}
+
+WorkStealingPool::Task *WorkStealingPool::TakeInjectedTask() {
+  if (injected_count_.load() == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(injected_mutex_);
+  if (injected_tasks_.empty())
+    return nullptr;
+  auto *task = injected_tasks_.front();
+  injected_tasks_.pop_front();
+  --injected_count_;
+  return task;
+}
+
+void WorkStealingPool::Push(Task *task) {
+  const auto worker_index = CurrentWorkerIndex();
+  if (worker_index < workers_.size()) {
+    workers_[worker_index]->deque.Push(task);
+  } else {
+    std::lock_guard<std::mutex> lock(injected_mutex_);
+    injected_tasks_.push_back(task);
+    ++injected_count_;
+  }
+  NotifyWork(false);
+}
+
+void WorkStealingPool::Execute(Task *task) {
+  if (task->group == nullptr) {
+    std::unique_ptr<Task> posted(task);
+    posted->function();
+    return;
+  }
+  auto &group = *task->group;
+  try {
+    task->function();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(group.exception_mutex_);
+    if (!group.exception_)
+      group.exception_ = std::current_exception();
+  }
+  delete task;
+  // the group may be destroyed as soon as its last task is counted
+  const bool is_group_finished = --group.pending_tasks_ == 0;
+  if (is_group_finished)
+    NotifyWork(true);
+}
+
+// Pairs with SleepUnlessChanged: either the sleeper sees the new epoch or
+// the notifier sees the sleeper.
+void WorkStealingPool::NotifyWork(bool is_group_finished) {
+  ++work_epoch_;
+  if (sleeping_threads_.load() == 0)
+    return;
+  std::lock_guard<std::mutex> lock(sleep_mutex_);
+  if (is_group_finished) {
+    work_available_.notify_all();
+  } else {
+    work_available_.notify_one();
+  }
+}
+
+template <typename Predicate>
+void WorkStealingPool::SleepUnlessChanged(std::uint64_t seen_epoch,
+                                          Predicate is_done) {
+  ++sleeping_threads_;
+  {
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    work_available_.wait(lock, [this, seen_epoch, &is_done]() {
+      return work_epoch_.load() != seen_epoch || is_done();
+    });
+  }
+  --sleeping_threads_;
+}
+
+} // namespace executors
+} // namespace action_graph
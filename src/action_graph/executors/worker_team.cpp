@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/worker_team.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace action_graph {
+namespace executors {
+
+WorkerTeam::WorkerTeam(std::size_t member_count,
+                       std::function<void(std::size_t)> task,
+                       WorkerTeamOptions options)
+    : task_(std::move(task)), spin_duration_(options.spin_duration),
+      member_exceptions_(member_count) {
+  const auto &configuration = options.member_threads;
+  members_.reserve(member_count);
+  for (std::size_t index = 0; index < member_count; ++index) {
+    auto member_configuration = configuration;
+    if (!configuration.name.empty() && member_count > 1)
+      member_configuration.name += std::to_string(index);
+    if (!configuration.cpu_affinity.empty())
+      member_configuration.cpu_affinity = {
+          configuration.cpu_affinity[index %
+                                     configuration.cpu_affinity.size()]};
+    members_.emplace_back(member_configuration,
+                          [this, index]() { MemberLoop(index); });
+  }
+}
+
+WorkerTeam::~WorkerTeam() {
+  is_stopping_ = true;
+  NotifySleepers();
+  for (auto &member : members_) {
+    member.Join();
+  }
+}
+
+void WorkerTeam::Release() {
+  unfinished_members_ = members_.size();
+  ++release_generation_;
+  NotifySleepers();
+}
+
+void WorkerTeam::Join() {
+  SpinThenSleep([this]() { return unfinished_members_.load() == 0; });
+  const auto first =
+      std::find_if(member_exceptions_.begin(), member_exceptions_.end(),
+                   [](const std::exception_ptr &exception) {
+                     return static_cast<bool>(exception);
+                   });
+  if (first == member_exceptions_.end())
+    return;
+  auto exception = *first;
+  std::fill(member_exceptions_.begin(), member_exceptions_.end(), nullptr);
+  std::rethrow_exception(exception);
+}
+
+std::size_t WorkerTeam::MemberCount() const noexcept {
+  return members_.size();
+}
+
+void WorkerTeam::MemberLoop(std::size_t index) {
+  std::uint64_t seen_generation = 0;
+  while (true) {
+    SpinThenSleep([this, seen_generation]() {
+      return release_generation_.load() != seen_generation ||
+             is_stopping_.load();
+    });
+    if (is_stopping_)
+      return;
+    seen_generation = release_generation_.load();
+    try {
+      task_(index);
+    } catch (...) {
+      member_exceptions_[index] = std::current_exception();
+    }
+    if (--unfinished_members_ == 0)
+      NotifySleepers();
+  }
+}
+
+// Pairs with NotifySleepers: either the sleeper sees the new state or the
+// notifier sees the sleeper.
+template <typename Predicate>
+void WorkerTeam::SpinThenSleep(Predicate is_done) {
+  const auto spin_end = std::chrono::steady_clock::now() + spin_duration_;
+  while (!is_done()) {
+    if (std::chrono::steady_clock::now() < spin_end) {
+      // lets a thread sharing the CPU make progress
+      std::this_thread::yield();
+      continue;
+    }
+    ++sleeping_threads_;
+    {
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      state_changed_.wait(lock, is_done);
+    }
+    --sleeping_threads_;
+    return;
+  }
+}
+
+void WorkerTeam::NotifySleepers() {
+  if (sleeping_threads_.load() == 0)
+    return;
+  std::lock_guard<std::mutex> lock(sleep_mutex_);
+  state_changed_.notify_all();
+}
+
+} // namespace executors
+} // namespace action_graph
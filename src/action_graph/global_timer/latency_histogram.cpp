@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/latency_histogram.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace action_graph {
+
+namespace {
+
+std::size_t HighestBit(std::uint64_t value) noexcept {
+  std::size_t bit = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++bit;
+  }
+  return bit;
+}
+
+} // namespace
+
+constexpr std::size_t LatencyHistogram::kSubBucketBits;
+constexpr std::size_t LatencyHistogram::kSubBucketCount;
+constexpr std::size_t LatencyHistogram::kMaximumExponent;
+constexpr std::size_t LatencyHistogram::kBucketCount;
+
+std::chrono::nanoseconds
+LatencyHistogramSnapshot::Percentile(double percentile) const {
+  if (count == 0)
+    return std::chrono::nanoseconds::zero();
+  const auto rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(
+             std::ceil(percentile / 100.0 * static_cast<double>(count))));
+  std::uint64_t cumulative_count = 0;
+  for (std::size_t index = 0; index < bucket_counts.size(); ++index) {
+    cumulative_count += bucket_counts[index];
+    if (cumulative_count >= rank) {
+      const std::chrono::nanoseconds upper_bound{static_cast<
+          std::chrono::nanoseconds::rep>(
+          LatencyHistogram::BucketUpperBound(index))};
+      return std::min(upper_bound, max);
+    }
+  }
+  return max;
+}
+
+void LatencyHistogram::Record(std::chrono::nanoseconds duration) noexcept {
+  const auto nanoseconds =
+      static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(
+          duration.count(), 0));
+  bucket_counts_[BucketIndex(nanoseconds)].fetch_add(
+      1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  total_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  auto max = max_.load(std::memory_order_relaxed);
+  while (nanoseconds > max &&
+         !max_.compare_exchange_weak(max, nanoseconds,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+LatencyHistogramSnapshot LatencyHistogram::Snapshot() const {
+  LatencyHistogramSnapshot snapshot;
+  snapshot.bucket_counts.reserve(kBucketCount);
+  for (const auto &bucket_count : bucket_counts_) {
+    snapshot.bucket_counts.push_back(
+        bucket_count.load(std::memory_order_relaxed));
+    snapshot.count += snapshot.bucket_counts.back();
+  }
+  const auto total = total_.load(std::memory_order_relaxed);
+  const auto count = count_.load(std::memory_order_relaxed);
+  if (count > 0)
+    snapshot.mean = std::chrono::nanoseconds{
+        static_cast<std::chrono::nanoseconds::rep>(total / count)};
+  snapshot.max = std::chrono::nanoseconds{static_cast<
+      std::chrono::nanoseconds::rep>(max_.load(std::memory_order_relaxed))};
+  return snapshot;
+}
+
+std::size_t LatencyHistogram::BucketIndex(std::uint64_t nanoseconds) noexcept {
+  if (nanoseconds < kSubBucketCount)
+    return static_cast<std::size_t>(nanoseconds);
+  const auto highest_bit = HighestBit(nanoseconds);
+  if (highest_bit >= kMaximumExponent)
+    return kBucketCount - 1;
+  const auto shift = highest_bit - kSubBucketBits;
+  return (shift + 1) * kSubBucketCount +
+         static_cast<std::size_t>((nanoseconds >> shift) &
+                                  (kSubBucketCount - 1));
+}
+
+std::uint64_t LatencyHistogram::BucketUpperBound(std::size_t index) noexcept {
+  if (index < kSubBucketCount)
+    return index;
+  const auto shift = index / kSubBucketCount - 1;
+  const auto sub_bucket = index % kSubBucketCount;
+  return ((kSubBucketCount + sub_bucket + 1) << shift) - 1;
+}
+
+} // namespace action_graph
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/precision.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace action_graph {
+
+std::chrono::nanoseconds MeasureSleepOvershoot() {
+  constexpr std::size_t kSamples = 20;
+  constexpr std::chrono::microseconds kSleepDuration{100};
+  std::vector<std::chrono::nanoseconds> overshoots;
+  overshoots.reserve(kSamples);
+  for (std::size_t sample = 0; sample < kSamples; ++sample) {
+    const auto wake_up = std::chrono::steady_clock::now() + kSleepDuration;
+    std::this_thread::sleep_until(wake_up);
+    overshoots.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - wake_up));
+  }
+  const auto percentile = overshoots.begin() + kSamples * 9 / 10;
+  std::nth_element(overshoots.begin(), percentile, overshoots.end());
+  return *percentile;
+}
+
+} // namespace action_graph
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/timerfd_waiter.h>
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace action_graph {
+
+namespace {
+
+void ThrowLastError(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+void AddToEpoll(int epoll_fd, int fd) {
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+    ThrowLastError("Could not add a file descriptor to epoll");
+}
+
+void Drain(int fd) {
+  std::uint64_t count;
+  while (read(fd, &count, sizeof(count)) > 0) {
+  }
+}
+
+void Close(int fd) {
+  if (fd >= 0)
+    close(fd);
+}
+
+} // namespace
+
+TimerFdWaiter::TimerFdWaiter() {
+  try {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0)
+      ThrowLastError("Could not create epoll instance");
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (timer_fd_ < 0)
+      ThrowLastError("Could not create timerfd");
+    event_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd_ < 0)
+      ThrowLastError("Could not create eventfd");
+    AddToEpoll(epoll_fd_, timer_fd_);
+    AddToEpoll(epoll_fd_, event_fd_);
+  } catch (...) {
+    Close(event_fd_);
+    Close(timer_fd_);
+    Close(epoll_fd_);
+    throw;
+  }
+}
+
+TimerFdWaiter::~TimerFdWaiter() {
+  Close(event_fd_);
+  Close(timer_fd_);
+  Close(epoll_fd_);
+}
+
+void TimerFdWaiter::NotifyAll() {
+  const std::uint64_t one = 1;
+  while (write(event_fd_, &one, sizeof(one)) < 0 && errno == EINTR) {
+  }
+}
+
+void TimerFdWaiter::ArmTimer(const TimePoint &deadline) {
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+  using std::chrono::seconds;
+  const auto since_epoch = deadline.time_since_epoch();
+  const auto whole_seconds = duration_cast<seconds>(since_epoch);
+  itimerspec specification{};
+  specification.it_value.tv_sec = static_cast<time_t>(whole_seconds.count());
+  specification.it_value.tv_nsec = static_cast<long>(
+      duration_cast<nanoseconds>(since_epoch - whole_seconds).count());
+  // a zero value would disarm the timer instead of expiring immediately
+  if (specification.it_value.tv_sec <= 0 && specification.it_value.tv_nsec <= 0)
+    specification.it_value.tv_nsec = 1;
+  Drain(timer_fd_);
+  timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &specification, nullptr);
+}
+
+void TimerFdWaiter::DisarmTimer() {
+  const itimerspec specification{};
+  timerfd_settime(timer_fd_, 0, &specification, nullptr);
+  Drain(timer_fd_);
+}
+
+bool TimerFdWaiter::WaitForEvents(std::unique_lock<std::mutex> &lock) {
+  constexpr int kMaximumEvents = 2;
+  epoll_event events[kMaximumEvents];
+  lock.unlock();
+  const int count = epoll_wait(epoll_fd_, events, kMaximumEvents, -1);
+  lock.lock();
+  bool has_expired = false;
+  for (int index = 0; index < count; ++index) {
+    if (events[index].data.fd == timer_fd_)
+      has_expired = true;
+    Drain(events[index].data.fd);
+  }
+  return has_expired;
+}
+
+} // namespace action_graph
+
+#endif // __linux__
@@ -4,34 +4,213 @@
 // License. See the LICENSE file in the root directory for full license text.
 
 #include <action_graph/global_timer/trigger.h>
+#include <algorithm>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 
 namespace action_graph {
 
-Trigger::Trigger(std::function<void()> callback)
-    : callback_(std::move(callback)) {}
+Trigger::Trigger(std::function<void()> callback, OverrunPolicy overrun_policy,
+                 std::size_t max_concurrent_executions)
+    : callback_(std::move(callback)), overrun_policy_(overrun_policy),
+      max_concurrent_executions_(overrun_policy ==
+                                         OverrunPolicy::kRunConcurrently
+                                     ? max_concurrent_executions
+                                     : 1) {
+  if (max_concurrent_executions_ == 0) {
+    throw std::invalid_argument(
+        "A trigger needs at least one concurrent execution.");
+  }
+}
 
 Trigger::Trigger(Trigger &&other) noexcept
     : callback_(std::move(other.callback_)),
-      is_running_(other.is_running_.load()) {}
+      overrun_policy_(other.overrun_policy_),
+      max_concurrent_executions_(other.max_concurrent_executions_),
+      active_executions_(other.active_executions_.load()),
+      has_pending_execution_(other.has_pending_execution_),
+      pending_deadline_(other.pending_deadline_),
+      is_disabled_(other.is_disabled_),
+      executed_count_(other.executed_count_.load()),
+      dropped_count_(other.dropped_count_.load()),
+      coalesced_count_(other.coalesced_count_.load()),
+      skipped_count_(other.skipped_count_.load()),
+      deadline_miss_count_(other.deadline_miss_count_.load()) {}
 
 Trigger::~Trigger() { WaitUntilTriggerIsFinished(); }
 
 void Trigger::TriggerAsynchronously() {
-  if (is_running_.exchange(true)) {
+  if (!TryToStart(ExecutionDeadline{})) {
     return;
   }
-  std::thread([this]() {
-    callback_();
-    is_running_ = false;
-  }).detach();
+  std::thread([this]() { Run(ExecutionDeadline{}); }).detach();
+}
+
+void Trigger::TriggerAsynchronously(executors::Executor &pool) {
+  TriggerAsynchronously(pool, ExecutionDeadline{});
+}
+
+void Trigger::TriggerAsynchronously(executors::Executor &pool,
+                                    const ExecutionDeadline &deadline) {
+  if (!TryToStart(deadline)) {
+    return;
+  }
+  if (deadline.is_earliest_deadline_first) {
+    pool.Post([this, deadline]() { Run(deadline); },
+              deadline.time_since_epoch);
+  } else {
+    pool.Post([this, deadline]() { Run(deadline); });
+  }
+}
+
+void Trigger::TriggerAsynchronously(const std::vector<BatchedFire> &batch,
+                                    executors::Executor &pool) {
+  std::vector<BatchedFire> started;
+  started.reserve(batch.size());
+  for (const auto &fire : batch) {
+    if (fire.trigger->TryToStart(fire.deadline)) {
+      started.push_back(fire);
+    }
+  }
+  if (started.empty()) {
+    return;
+  }
+  auto run_all = [started]() {
+    for (const auto &fire : started) {
+      fire.trigger->Run(fire.deadline);
+    }
+  };
+  if (started.front().deadline.is_earliest_deadline_first) {
+    const auto earliest = std::min_element(
+        started.begin(), started.end(),
+        [](const BatchedFire &lhs, const BatchedFire &rhs) {
+          return lhs.deadline.time_since_epoch <
+                 rhs.deadline.time_since_epoch;
+        });
+    pool.Post(std::move(run_all), earliest->deadline.time_since_epoch);
+  } else {
+    pool.Post(std::move(run_all));
+  }
+}
+
+void Trigger::TriggerSynchronously() {
+  TriggerSynchronously(ExecutionDeadline{});
+}
+
+void Trigger::TriggerSynchronously(const ExecutionDeadline &deadline) {
+  if (!TryToStart(deadline)) {
+    return;
+  }
+  try {
+    Run(deadline);
+  } catch (...) {
+    FinishAfterFailure();
+    throw;
+  }
 }
 
 void Trigger::WaitUntilTriggerIsFinished() const {
-  while (is_running_) {
-    std::this_thread::yield();
+  std::unique_lock<std::mutex> lock(state_mutex_);
+  finished_conditional_variable_.wait(
+      lock, [this]() { return active_executions_ == 0; });
+}
+
+void Trigger::Disable() {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  is_disabled_ = true;
+  has_pending_execution_ = false;
+}
+
+void Trigger::CountSkippedDeadlines(std::uint64_t count) noexcept {
+  skipped_count_ += count;
+}
+
+TriggerStatistics Trigger::GetStatistics() const noexcept {
+  TriggerStatistics statistics;
+  statistics.executed = executed_count_.load();
+  statistics.dropped = dropped_count_.load();
+  statistics.coalesced = coalesced_count_.load();
+  statistics.skipped = skipped_count_.load();
+  statistics.deadline_misses = deadline_miss_count_.load();
+  return statistics;
+}
+
+bool Trigger::TryToStart(const ExecutionDeadline &deadline) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (is_disabled_) {
+    return false;
+  }
+  if (active_executions_ < max_concurrent_executions_) {
+    ++active_executions_;
+    ++executed_count_;
+    return true;
+  }
+  switch (overrun_policy_) {
+  case OverrunPolicy::kQueueOne:
+    // the first missed fire keeps its deadline, later ones are dropped
+    if (has_pending_execution_) {
+      ++dropped_count_;
+      break;
+    }
+    has_pending_execution_ = true;
+    pending_deadline_ = deadline;
+    break;
+  case OverrunPolicy::kCoalesce:
+    // the pending execution catches up to the latest fire
+    if (has_pending_execution_) {
+      ++coalesced_count_;
+    }
+    has_pending_execution_ = true;
+    pending_deadline_ = deadline;
+    break;
+  case OverrunPolicy::kSkip:
+  case OverrunPolicy::kRunConcurrently:
+    ++dropped_count_;
+    break;
+  }
+  return false;
+}
+
+bool Trigger::TryToContinueWithPendingExecution(ExecutionDeadline &deadline) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  if (has_pending_execution_) {
+    has_pending_execution_ = false;
+    deadline = pending_deadline_;
+    ++executed_count_;
+    return true;
+  }
+  // notified under the lock, because a waiting destructor may destroy the
+  // condition variable as soon as the lock is released
+  if (--active_executions_ == 0) {
+    finished_conditional_variable_.notify_all();
+  }
+  return false;
+}
+
+void Trigger::FinishAfterFailure() {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  has_pending_execution_ = false;
+  if (--active_executions_ == 0) {
+    finished_conditional_variable_.notify_all();
+  }
+}
+
+void Trigger::Run(ExecutionDeadline deadline) {
+  do {
+    callback_();
+    if (IsMissed(deadline)) {
+      ++deadline_miss_count_;
+    }
+  } while (TryToContinueWithPendingExecution(deadline));
+}
+
+bool Trigger::IsMissed(const ExecutionDeadline &deadline) {
+  if (deadline.now != nullptr) {
+    return deadline.now() > deadline.time_since_epoch;
   }
+  return deadline.has_virtual_finish_time &&
+         deadline.virtual_finish_time > deadline.time_since_epoch;
 }
 
 } // namespace action_graph
@@ -35,6 +35,14 @@ public:
     }
   }
 
+  // Moves the children out, e.g. to compile them into a plan, and leaves the
+  // sequence without children.
+  std::vector<std::unique_ptr<Action>> ReleaseActions() {
+    auto actions = std::move(sequence_);
+    sequence_.clear();
+    return actions;
+  }
+
 private:
   static void AppendActions() {}
 
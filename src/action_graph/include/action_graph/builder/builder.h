@@ -8,7 +8,10 @@
 #include <action_graph/action.h>
 #include <action_graph/builder/configuration_node.h>
 #include <action_graph/builder/parse_duration.h>
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_configuration.h>
 #include <action_graph/global_timer/global_timer.h>
+#include <action_graph/global_timer/trigger_options.h>
 
 #include <chrono>
 #include <functional>
@@ -42,10 +45,37 @@ public:
   using std::runtime_error::runtime_error;
 };
 
-template <typename Clock>
+// Reads the optional scheduling settings of a trigger node, e.g.
+//   overrun_policy: concurrent
+//   max_concurrent_executions: 2
+//   phase: 5 milliseconds
+//   deadline: 2 milliseconds
+//   tolerance: 1 milliseconds
+//   catch_up_policy: limited_burst
+//   max_catch_up_fires: 3
+//   thread:
+//     name: sensor
+// A trigger with thread settings runs on a dedicated thread.
+TriggerOptions ParseTriggerOptions(const ConfigurationNode &trigger);
+
+// Reads a number greater than zero. The key names the value in errors.
+std::size_t ParsePositiveCount(const ConfigurationNode &node,
+                               const std::string &key);
+
+// Reads the settings of a thread node, e.g.
+//   name: sensor
+//   cpu_affinity: [2, 3]
+//   scheduling_policy: fifo
+//   priority: 80
+//   stack_size: 262144
+executors::ThreadConfiguration
+ParseThreadConfiguration(const ConfigurationNode &thread);
+
+// Registers every trigger of the configuration on the timer, which is a
+// GlobalTimer or any timer with the same SetTriggerTime interface.
+template <typename Timer>
 auto BuildActionGraph(const ConfigurationNode &configuration,
-                      const ActionBuilder &action_builder,
-                      action_graph::GlobalTimer<Clock> &global_timer)
+                      const ActionBuilder &action_builder, Timer &global_timer)
     -> std::vector<ActionObject> {
   std::vector<ActionObject> created_actions;
   for (size_t entry_index = 0; entry_index < configuration.Size();
@@ -57,24 +87,54 @@ auto BuildActionGraph(const ConfigurationNode &configuration,
   return created_actions;
 }
 
-template <typename Clock>
+// Like above, but the callbacks of all triggers without a dedicated thread
+// run on the executor, which has to outlive the timer.
+template <typename Timer>
+auto BuildActionGraph(const ConfigurationNode &configuration,
+                      const ActionBuilder &action_builder, Timer &global_timer,
+                      executors::Executor &executor)
+    -> std::vector<ActionObject> {
+  std::vector<ActionObject> created_actions;
+  for (size_t entry_index = 0; entry_index < configuration.Size();
+       ++entry_index) {
+    const auto &entry = configuration.Get(entry_index);
+    created_actions.push_back(
+        BuildTrigger(entry, action_builder, global_timer, &executor));
+  }
+  return created_actions;
+}
+
+template <typename Timer>
 ActionObject BuildTrigger(const ConfigurationNode &node,
                           const ActionBuilder &action_builder,
-                          GlobalTimer<Clock> &global_timer) {
+                          Timer &global_timer) {
+  return BuildTrigger(node, action_builder, global_timer, nullptr);
+}
+
+// Without an executor, the callbacks run where the trigger options decide.
+// A trigger with a dedicated thread keeps it also with an executor.
+template <typename Timer>
+ActionObject BuildTrigger(const ConfigurationNode &node,
+                          const ActionBuilder &action_builder,
+                          Timer &global_timer, executors::Executor *executor) {
   if (!node.HasKey("trigger"))
     throw ConfigurationError("Only trigger nodes are allowed on top level.",
                              node);
   const auto &trigger = node.Get("trigger");
-  auto trigger_name = trigger.Get("name").AsString();
   auto trigger_period_string = trigger.Get("period").AsString();
   auto trigger_period = ParseDuration(trigger_period_string);
   auto casted_trigger_period =
-      std::chrono::duration_cast<typename Clock::duration>(trigger_period);
+      std::chrono::duration_cast<typename Timer::Duration>(trigger_period);
+
+  auto trigger_options = ParseTriggerOptions(trigger);
+  if (executor != nullptr && !trigger_options.has_dedicated_thread)
+    trigger_options.executor = executor;
 
   auto action_pointer = action_builder(trigger);
   auto &action = *action_pointer;
   global_timer.SetTriggerTime(casted_trigger_period,
-                              [&action]() { action.Execute(); });
+                              [&action]() { action.Execute(); },
+                              std::move(trigger_options));
 
   return action_pointer;
 }
@@ -7,6 +7,7 @@
 
 #include <action_graph/builder/builder.h>
 #include <action_graph/builder/generic_action_decorator.h>
+#include <action_graph/executors/executor.h>
 
 #include <functional>
 
@@ -34,6 +35,10 @@ std::vector<ActionObject> BuildActions(const ConfigurationNode &node,
                                        const ActionBuilder &action_builder);
 
 GenericActionBuilder CreateGenericActionBuilderWithDefaultActions();
+// The parallel_actions and dag_actions run their children on the executor,
+// which has to outlive the built actions.
+GenericActionBuilder
+CreateGenericActionBuilderWithDefaultActions(executors::Executor &executor);
 } // namespace builder
 } // namespace action_graph
 #endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_BUILDER_GENERIC_ACTION_BUILDER_H_
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_EXECUTION_PLAN_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_EXECUTION_PLAN_H_
+
+#include <action_graph/action.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace action_graph {
+namespace compiler {
+
+// A run of leaf actions, which are executed one after the other, once all
+// predecessor steps finished. A step without actions joins its predecessors.
+struct PlanStep {
+  std::size_t first_action;
+  std::size_t action_count;
+  std::size_t first_successor;
+  std::size_t successor_count;
+  std::size_t predecessor_count;
+};
+
+// A flat form of a tree of actions. The steps, which are ready at the same
+// time, run in parallel.
+struct ExecutionPlan {
+  std::string name;
+  // the leaf actions, ordered by step
+  std::vector<std::unique_ptr<Action>> actions;
+  std::vector<PlanStep> steps;
+  // the successors of all steps, see PlanStep::first_successor
+  std::vector<std::size_t> successors;
+};
+
+// Lowers the tree below action into a plan. Before, the tree is simplified:
+// decorators, which are no-ops, are dropped, nested sequences and nested
+// parallel actions are merged into their parents, and sequences and
+// parallel actions with a single child are replaced by the child. Every
+// other action, including decorators and DagActions, becomes a leaf with its
+// subtree.
+//
+// The execution settings of ParallelActions, i.e. a team, a concurrency
+// limit or adaptive granularity, do not carry over to the plan.
+ExecutionPlan CompilePlan(std::unique_ptr<Action> action);
+
+} // namespace compiler
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_EXECUTION_PLAN_H_
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_PLAN_EXECUTOR_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_PLAN_EXECUTOR_H_
+
+#include <action_graph/action.h>
+#include <action_graph/compiler/execution_plan.h>
+#include <action_graph/dag_actions.h>
+#include <action_graph/executors/executor.h>
+#include <memory>
+
+namespace action_graph {
+namespace compiler {
+
+// Executes a compiled plan. A plan of a single step runs its actions in a
+// loop on the executing thread. Otherwise, the steps are scheduled like the
+// nodes of DagActions, each step as soon as its predecessors finished. Like
+// the actions of the plan, the plan may be executed by several threads at
+// the same time.
+class PlanExecutor final : public Action {
+public:
+  // The steps run on new threads and on the executing thread.
+  explicit PlanExecutor(ExecutionPlan plan);
+
+  // The steps run on the executor, which has to outlive this object, and on
+  // the executing thread.
+  PlanExecutor(ExecutionPlan plan, executors::Executor &executor);
+
+  void Execute() override;
+
+  const ExecutionPlan &GetPlan() const noexcept;
+
+private:
+  std::vector<DagNode> CreateStepNodes();
+
+  ExecutionPlan plan_;
+  std::unique_ptr<DagActions> steps_{};
+};
+
+} // namespace compiler
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_COMPILER_PLAN_EXECUTOR_H_
@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_DAG_ACTIONS_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_DAG_ACTIONS_H_
+
+#include <action_graph/action.h>
+#include <action_graph/executors/executor.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace action_graph {
+
+struct DagNode {
+  std::unique_ptr<Action> action;
+  // The indices of the nodes, which have to finish before this one starts.
+  std::vector<std::size_t> depends_on;
+};
+
+// Executes a directed acyclic graph of actions. Every node starts as soon as
+// its predecessors finished, instead of waiting for a whole level of the
+// graph. Once a node threw, the nodes, which did not start yet, are skipped
+// and Execute rethrows the exception of the first node in the vector. If a
+// helper cannot be posted, the nodes are skipped in the same way and Execute
+// passes the exception of the executor on. Several threads may execute the
+// same graph at the same time, e.g. a trigger with the concurrent overrun
+// policy.
+class DagActions final : public Action {
+public:
+  // Every node runs on a new thread or on the executing thread. Throws
+  // std::invalid_argument, if a dependency is out of range or the
+  // dependencies contain a cycle.
+  DagActions(std::string name, std::vector<DagNode> nodes);
+
+  // The nodes are executed on the executor, which has to outlive this
+  // object, and on the executing thread. The executing thread runs every
+  // node, which is ready and no helper has started yet, so that nested
+  // graphs do not deadlock.
+  DagActions(std::string name, std::vector<DagNode> nodes,
+             executors::Executor &executor);
+
+  // Waits for helpers, which were posted but found no node to run.
+  ~DagActions() override;
+
+  void Execute() override;
+
+private:
+  // The state of one execution.
+  struct ExecutionState {
+    explicit ExecutionState(std::size_t node_count);
+
+    // counted down as the predecessors finish, without a lock
+    std::unique_ptr<std::atomic<std::size_t>[]> unfinished_predecessors;
+    std::atomic<bool> is_failed{false};
+    std::vector<std::exception_ptr> node_exceptions;
+    std::exception_ptr post_exception{};
+    // every node becomes ready once per execution, so that the ready nodes
+    // are appended to a vector of the node count, guarded by state_mutex_
+    std::vector<std::size_t> ready_nodes;
+    std::size_t next_ready_node{0};
+    std::size_t ready_node_end{0};
+    std::size_t unfinished_nodes{0};
+    std::size_t helpers_in_flight{0};
+  };
+
+  void LinkSuccessors();
+  void ThrowOnCycle() const;
+  ExecutionState &AcquireState();
+  void ReleaseState(ExecutionState &state);
+  void PostHelpers(ExecutionState &state, std::size_t helper_count);
+  void RunHelper(ExecutionState &state);
+  bool TryClaimReadyNode(ExecutionState &state, std::size_t &node);
+  void RunNode(ExecutionState &state, std::size_t node);
+  void ReleaseSuccessors(ExecutionState &state, std::size_t node);
+  void FinishNode(ExecutionState &state);
+  static std::exception_ptr TakeFirstException(ExecutionState &state);
+
+  std::vector<DagNode> nodes_;
+  executors::ThreadPerTaskExecutor thread_per_task_executor_{};
+  executors::Executor &executor_;
+
+  // the successors of node i are successors_[successor_begins_[i]] up to
+  // successors_[successor_begins_[i + 1]]
+  std::vector<std::size_t> successor_begins_{};
+  std::vector<std::size_t> successors_{};
+  std::vector<std::size_t> roots_{};
+
+  // one execution state per concurrent execution, allocated once, both
+  // guarded by state_mutex_
+  std::vector<std::unique_ptr<ExecutionState>> states_{};
+  std::vector<ExecutionState *> free_states_{};
+  std::mutex state_mutex_{};
+  std::condition_variable state_changed_{};
+};
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_DAG_ACTIONS_H_
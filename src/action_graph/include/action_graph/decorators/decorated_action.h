@@ -21,6 +21,13 @@ public:
     }
   }
 
+  // A decorator, which adds nothing to the execution of its action, returns
+  // true, so that the plan compiler drops it.
+  virtual bool IsNoOp() const noexcept { return false; }
+
+  // Moves the action out and leaves the decorator without an action.
+  std::unique_ptr<Action> ReleaseAction() { return std::move(action_); }
+
 protected:
   Action &GetAction() { return *action_; }
   const Action &GetAction() const { return *action_; }
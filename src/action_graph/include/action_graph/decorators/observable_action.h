@@ -8,6 +8,7 @@
 #include <action_graph/decorators/decorated_action.h>
 #include <action_graph/decorators/execution_observer.h>
 #include <memory>
+#include <typeinfo>
 
 namespace action_graph {
 namespace decorators {
@@ -30,6 +31,12 @@ public:
     observer_->OnFinished();
   }
 
+  // Only the exact type counts, a derived observer may override the
+  // callbacks.
+  bool IsNoOp() const noexcept override {
+    return typeid(*observer_) == typeid(NoOperationExecutionObserver);
+  }
+
 private:
   std::unique_ptr<ExecutionObserver> observer_;
 };
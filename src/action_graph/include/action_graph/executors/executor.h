@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_EXECUTOR_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_EXECUTOR_H_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+namespace action_graph {
+namespace executors {
+
+// Decides where work runs. The timer posts the callbacks of its triggers,
+// ParallelActions runs its children with RunAll.
+class Executor {
+public:
+  virtual ~Executor() = default;
+
+  // Runs the task without waiting for it.
+  virtual void Post(std::function<void()> task) = 0;
+  // Like Post. Executors which queue their tasks start the ones with a
+  // deadline earliest deadline first. The deadline is a time since the epoch
+  // of the clock of the caller.
+  virtual void Post(std::function<void()> task,
+                    std::chrono::nanoseconds deadline) = 0;
+  // Calls task(0) to task(count - 1), possibly in parallel, and returns when
+  // all calls returned. Rethrows the first exception thrown by a call.
+  virtual void RunAll(std::size_t count,
+                      const std::function<void(std::size_t)> &task) = 0;
+};
+
+// Runs every task on the calling thread before returning. RunAll stops at the
+// first exception.
+class InlineExecutor final : public Executor {
+public:
+  void Post(std::function<void()> task) override;
+  void Post(std::function<void()> task,
+            std::chrono::nanoseconds deadline) override;
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override;
+};
+
+// Starts a new thread for every task, which was the only behavior of
+// ParallelActions and Trigger before executors were introduced.
+class ThreadPerTaskExecutor final : public Executor {
+public:
+  void Post(std::function<void()> task) override;
+  void Post(std::function<void()> task,
+            std::chrono::nanoseconds deadline) override;
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override;
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_EXECUTOR_H_
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_CONFIGURATION_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_CONFIGURATION_H_
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace action_graph {
+namespace executors {
+
+enum class SchedulingPolicy { kDefault, kFifo, kRoundRobin };
+
+// The attributes of a thread, which affect its latency. The defaults keep
+// the attributes inherited from the creating thread.
+struct ThreadConfiguration {
+  // Linux uses at most the first 15 characters.
+  std::string name{};
+  // The indices of the CPUs the thread may run on. Empty means all CPUs.
+  std::vector<std::size_t> cpu_affinity{};
+  SchedulingPolicy scheduling_policy{SchedulingPolicy::kDefault};
+  // Clamped to the range of the real-time scheduling policy.
+  int priority{0};
+  // Zero keeps the default stack size.
+  std::size_t stack_size{0};
+};
+
+// Applies name, affinity and scheduling policy to the calling thread.
+// Settings which are not supported by the platform or not permitted, e.g.
+// real-time scheduling without the required capability, are left at their
+// defaults. Returns false in this case. A ConfiguredThread reports this
+// result by IsConfigurationApplied.
+bool ApplyToCurrentThread(const ThreadConfiguration &configuration);
+
+// A joinable thread created with a ThreadConfiguration. The destructor joins
+// the thread.
+class ConfiguredThread {
+public:
+  ConfiguredThread() = default;
+  ConfiguredThread(const ThreadConfiguration &configuration,
+                   std::function<void()> function);
+
+  ConfiguredThread(const ConfiguredThread &) = delete;
+  ConfiguredThread(ConfiguredThread &&other) noexcept;
+  ConfiguredThread &operator=(const ConfiguredThread &) = delete;
+  ConfiguredThread &operator=(ConfiguredThread &&other) noexcept;
+
+  ~ConfiguredThread();
+
+  bool Joinable() const noexcept;
+  void Join();
+
+  // Waits until the thread applied its configuration and returns the result
+  // of ApplyToCurrentThread, also after the thread is joined.
+  bool IsConfigurationApplied() const;
+
+private:
+#ifdef __linux__
+  pthread_t handle_{};
+  bool is_joinable_{false};
+#else
+  std::thread thread_{};
+#endif
+  std::shared_future<bool> is_configuration_applied_{};
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_CONFIGURATION_H_
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_POOL_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_POOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_configuration.h>
+
+namespace action_graph {
+namespace executors {
+
+// A fixed number of workers, which take the tasks from a shared queue.
+class ThreadPool final : public Executor {
+public:
+  explicit ThreadPool(std::size_t thread_count);
+  // The name of each worker gets its index appended, if there is more than
+  // one worker.
+  ThreadPool(std::size_t thread_count, ThreadConfiguration configuration);
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  // Runs all tasks which are already posted before joining the workers.
+  ~ThreadPool() override;
+
+  void Post(std::function<void()> task) override;
+  // Tasks posted with a deadline are started earliest deadline first and
+  // before all tasks posted without one. Tasks with the same deadline are
+  // started in the order they were posted. The deadline is a time since the
+  // epoch of the clock of the caller.
+  void Post(std::function<void()> task,
+            std::chrono::nanoseconds deadline) override;
+  // The calling thread takes part in the calls, so that RunAll does not
+  // deadlock when it is nested on the workers.
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override;
+
+  std::size_t ThreadCount() const noexcept;
+
+  // Whether every worker applied its ThreadConfiguration. Waits until all
+  // workers tried to.
+  bool AreWorkersConfigured() const;
+
+  // At least two threads, so that a single long-running task does not block
+  // all other tasks on single core machines.
+  static std::size_t DefaultThreadCount() noexcept;
+
+private:
+  struct DeadlineTask {
+    std::chrono::nanoseconds deadline;
+    std::uint64_t sequence;
+    std::function<void()> task;
+  };
+
+  static bool IsLater(const DeadlineTask &lhs, const DeadlineTask &rhs);
+  void PushTask(std::function<void()> task);
+  std::function<void()> TakeNextTask();
+  void WorkerLoop();
+
+  std::mutex tasks_mutex_{};
+  std::condition_variable task_available_{};
+  // A ring buffer, which only grows, so that posting does not allocate once
+  // the pool is warmed up.
+  std::vector<std::function<void()>> tasks_{};
+  std::size_t first_task_{0};
+  std::size_t task_count_{0};
+  // min-heap ordered by deadline and sequence
+  std::vector<DeadlineTask> deadline_tasks_{};
+  std::uint64_t posted_deadline_tasks_{0};
+  bool is_stopping_{false};
+  std::vector<ConfiguredThread> workers_{};
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_THREAD_POOL_H_
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_DEQUE_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace action_graph {
+namespace executors {
+
+// The deque of Chase and Lev. The owning thread pushes and pops at the
+// bottom, any other thread steals from the top without taking a lock. The
+// buffer grows when it is full; replaced buffers are kept until the deque is
+// destroyed, because a thief may still read from them.
+template <typename T> class WorkStealingDeque {
+public:
+  WorkStealingDeque() : buffer_(new Buffer(kInitialCapacity)) {
+    buffers_.emplace_back(buffer_.load());
+  }
+
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  // Only called by the owner.
+  void Push(T *item) {
+    const auto bottom = bottom_.load(std::memory_order_relaxed);
+    const auto top = top_.load(std::memory_order_acquire);
+    auto *buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->capacity - 1) {
+      buffer = buffer->Grow(bottom, top);
+      buffers_.emplace_back(buffer);
+      buffer_.store(buffer, std::memory_order_release);
+    }
+    buffer->Put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  // Only called by the owner. Returns the most recently pushed item or
+  // nullptr, if the deque is empty.
+  T *Pop() {
+    const auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    auto *buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto *item = buffer->Get(bottom);
+    if (top == bottom) {
+      // the last item, which a thief may take at the same time
+      if (!top_.compare_exchange_strong(top, top + 1,
+                                        std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        item = nullptr;
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  // Returns the least recently pushed item or nullptr, if the deque is
+  // empty or another thread took the item at the same time.
+  T *Steal() {
+    auto top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom)
+      return nullptr;
+    auto *item = buffer_.load(std::memory_order_acquire)->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+    return item;
+  }
+
+  bool IsEmpty() const noexcept {
+    return top_.load(std::memory_order_acquire) >=
+           bottom_.load(std::memory_order_acquire);
+  }
+
+private:
+  struct Buffer {
+    explicit Buffer(std::int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<T *>[capacity]) {}
+
+    T *Get(std::int64_t index) const {
+      return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+
+    void Put(std::int64_t index, T *item) {
+      slots[index & (capacity - 1)].store(item, std::memory_order_relaxed);
+    }
+
+    Buffer *Grow(std::int64_t bottom, std::int64_t top) const {
+      auto *grown = new Buffer(capacity * 2);
+      for (auto index = top; index < bottom; ++index)
+        grown->Put(index, Get(index));
+      return grown;
+    }
+
+    // a power of two
+    const std::int64_t capacity;
+    const std::unique_ptr<std::atomic<T *>[]> slots;
+  };
+
+  static constexpr std::int64_t kInitialCapacity = 64;
+
+  std::atomic<std::int64_t> top_{0};
+  std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Buffer *> buffer_;
+  // owned by the owner of the deque
+  std::vector<std::unique_ptr<Buffer>> buffers_{};
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_DEQUE_H_
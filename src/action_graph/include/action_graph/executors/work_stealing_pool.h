@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_POOL_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_configuration.h>
+#include <action_graph/executors/work_stealing_deque.h>
+
+namespace action_graph {
+namespace executors {
+
+// The tasks submitted with the same group are waited for together.
+class TaskGroup {
+public:
+  TaskGroup() = default;
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+private:
+  friend class WorkStealingPool;
+
+  std::atomic<std::size_t> pending_tasks_{0};
+  std::mutex exception_mutex_{};
+  std::exception_ptr exception_{};
+};
+
+// A pool for fork-join parallelism. Every worker has a deque of its own,
+// where it pushes and pops the tasks it submits. Idle workers steal from the
+// other deques without taking a lock. Threads which are not workers of the
+// pool submit through a shared queue. A thread waiting for a group executes
+// pending tasks meanwhile, so that nested fork-join neither deadlocks nor
+// needs more threads.
+class WorkStealingPool final : public Executor {
+public:
+  explicit WorkStealingPool(std::size_t thread_count);
+  // The name of each worker gets its index appended, if there is more than
+  // one worker.
+  WorkStealingPool(std::size_t thread_count, ThreadConfiguration configuration);
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool(WorkStealingPool &&) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(WorkStealingPool &&) = delete;
+
+  // All groups have to be waited for before.
+  ~WorkStealingPool() override;
+
+  void Submit(TaskGroup &group, std::function<void()> task);
+  // Tasks without a group are not waited for. Their exceptions are not
+  // caught, like on any other thread.
+  void Post(std::function<void()> task) override;
+  // The deadline is ignored, the deques are not ordered.
+  void Post(std::function<void()> task,
+            std::chrono::nanoseconds deadline) override;
+  // Runs the calls as tasks of one group and waits for it.
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override;
+
+  // Returns when all tasks of the group are finished and rethrows the first
+  // exception thrown by one of them.
+  void Wait(TaskGroup &group);
+
+  std::size_t ThreadCount() const noexcept;
+
+private:
+  struct Task {
+    std::function<void()> function;
+    // nullptr for posted tasks
+    TaskGroup *group;
+  };
+
+  struct Worker {
+    WorkStealingDeque<Task> deque{};
+    ConfiguredThread thread{};
+  };
+
+  void WorkerLoop(std::size_t index);
+  // The index of the calling worker or ThreadCount() for other threads.
+  std::size_t CurrentWorkerIndex() const noexcept;
+  Task *FindTask(std::size_t worker_index);
+  Task *TakeInjectedTask();
+  void Push(Task *task);
+  void Execute(Task *task);
+  void NotifyWork(bool is_group_finished);
+  template <typename Predicate>
+  void SleepUnlessChanged(std::uint64_t seen_epoch, Predicate is_done);
+
+  std::vector<std::unique_ptr<Worker>> workers_{};
+
+  std::mutex injected_mutex_{};
+  std::deque<Task *> injected_tasks_{};
+  std::atomic<std::size_t> injected_count_{0};
+
+  // counts every submission and every finished group, so that sleeping
+  // threads notice new work
+  std::atomic<std::uint64_t> work_epoch_{0};
+  std::atomic<std::size_t> sleeping_threads_{0};
+  std::mutex sleep_mutex_{};
+  std::condition_variable work_available_{};
+  std::atomic<bool> is_stopping_{false};
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORK_STEALING_POOL_H_
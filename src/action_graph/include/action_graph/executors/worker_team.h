@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORKER_TEAM_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORKER_TEAM_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <action_graph/executors/thread_configuration.h>
+
+namespace action_graph {
+namespace executors {
+
+struct WorkerTeamOptions {
+  // How long the members wait for a release and the releasing thread waits
+  // for the join by polling, before they sleep on a condition variable.
+  // Zero sleeps right away.
+  std::chrono::nanoseconds spin_duration{std::chrono::microseconds{50}};
+  // The name of each member gets its index appended. Member i is pinned to
+  // cpu_affinity[i % cpu_affinity.size()], if not empty.
+  ThreadConfiguration member_threads{};
+};
+
+// A fixed team of threads, which run the same task on every release and meet
+// again at a barrier. Releasing and joining costs a few atomic operations as
+// long as the members are still polling.
+class WorkerTeam {
+public:
+  // Member i calls task(i) on every release.
+  WorkerTeam(std::size_t member_count, std::function<void(std::size_t)> task,
+             WorkerTeamOptions options = {});
+
+  WorkerTeam(const WorkerTeam &) = delete;
+  WorkerTeam(WorkerTeam &&) = delete;
+  WorkerTeam &operator=(const WorkerTeam &) = delete;
+  WorkerTeam &operator=(WorkerTeam &&) = delete;
+
+  // The team has to be joined before.
+  ~WorkerTeam();
+
+  // Starts the task on every member. Only called after the previous release
+  // was joined.
+  void Release();
+  // Returns when every member finished the task of the last release and
+  // rethrows the first exception thrown by one of them.
+  void Join();
+
+  std::size_t MemberCount() const noexcept;
+
+private:
+  void MemberLoop(std::size_t index);
+  template <typename Predicate> void SpinThenSleep(Predicate is_done);
+  void NotifySleepers();
+
+  const std::function<void(std::size_t)> task_;
+  const std::chrono::nanoseconds spin_duration_;
+
+  std::atomic<std::uint64_t> release_generation_{0};
+  std::atomic<std::size_t> unfinished_members_{0};
+  std::atomic<bool> is_stopping_{false};
+  std::atomic<std::size_t> sleeping_threads_{0};
+  std::mutex sleep_mutex_{};
+  std::condition_variable state_changed_{};
+  std::vector<std::exception_ptr> member_exceptions_{};
+  // declared last, so that the members start after the state above
+  std::vector<ConfiguredThread> members_{};
+};
+
+} // namespace executors
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_EXECUTORS_WORKER_TEAM_H_
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_COMMAND_QUEUE_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_COMMAND_QUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+namespace action_graph {
+
+// Any number of threads push commands without taking a lock, a single
+// consumer takes all pending commands at once in the order they were pushed.
+template <typename Command> class CommandQueue {
+public:
+  CommandQueue() = default;
+  CommandQueue(const CommandQueue &) = delete;
+  CommandQueue &operator=(const CommandQueue &) = delete;
+
+  ~CommandQueue() { Delete(head_.exchange(nullptr)); }
+
+  void Push(Command command) {
+    auto *node = new Node{std::move(command), head_.load()};
+    while (!head_.compare_exchange_weak(node->next, node)) {
+    }
+  }
+
+  bool IsEmpty() const noexcept { return head_.load() == nullptr; }
+
+  template <typename Consume> void ConsumeAll(Consume consume) {
+    Node *newest = head_.exchange(nullptr);
+    Node *oldest = nullptr;
+    while (newest != nullptr) {
+      auto *next = newest->next;
+      newest->next = oldest;
+      oldest = newest;
+      newest = next;
+    }
+    while (oldest != nullptr) {
+      auto *next = oldest->next;
+      consume(oldest->command);
+      delete oldest;
+      oldest = next;
+    }
+  }
+
+private:
+  struct Node {
+    Command command;
+    Node *next;
+  };
+
+  static void Delete(Node *node) {
+    while (node != nullptr) {
+      auto *next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  std::atomic<Node *> head_{nullptr};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_COMMAND_QUEUE_H_
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_CONDITION_VARIABLE_WAITER_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_CONDITION_VARIABLE_WAITER_H_
+
+#include <condition_variable>
+#include <mutex>
+
+namespace action_graph {
+
+// Lets the timer thread sleep until a deadline of any clock or until it is
+// notified. The predicate is checked with the lock held.
+template <typename Clock> class ConditionVariableWaiter {
+public:
+  using TimePoint = typename Clock::time_point;
+
+  template <typename IsAwake>
+  void Wait(std::unique_lock<std::mutex> &lock, IsAwake is_awake) {
+    conditional_variable_.wait(lock, is_awake);
+  }
+
+  template <typename IsAwake>
+  void WaitUntil(std::unique_lock<std::mutex> &lock, const TimePoint &deadline,
+                 IsAwake is_awake) {
+    conditional_variable_.wait_until(lock, deadline, is_awake);
+  }
+
+  // Has to be called after the state checked by the predicate changed under
+  // the lock.
+  void NotifyAll() { conditional_variable_.notify_all(); }
+
+private:
+  std::condition_variable conditional_variable_{};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_CONDITION_VARIABLE_WAITER_H_
@@ -5,16 +5,33 @@
 #ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_GLOBAL_TIMER_H_
 #define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_GLOBAL_TIMER_H_
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <vector>
 
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_configuration.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/global_timer/command_queue.h>
+#include <action_graph/global_timer/condition_variable_waiter.h>
+#include <action_graph/global_timer/global_timer_options.h>
+#include <action_graph/global_timer/latency_histogram.h>
+#include <action_graph/global_timer/precision.h>
+#include <action_graph/global_timer/schedule.h>
+#include <action_graph/global_timer/timer_instrumentation.h>
 #include <action_graph/global_timer/trigger.h>
+#include <action_graph/global_timer/trigger_options.h>
+#include <action_graph/global_timer/trigger_scheduler.h>
 
 namespace action_graph {
 
@@ -38,92 +55,447 @@ private:
   std::function<void(TimePoint)> on_jump_callback_;
 };
 
-template <typename Clock> class GlobalTimer {
+// Reports, if the timer loop wakes up later than the deadline it slept for
+// by more than the threshold. This happens after the process was suspended or
+// starved, or when the clock jumped forward.
+template <typename Clock> class StallDetector {
 public:
   using Duration = typename Clock::duration;
   using TimePoint = typename Clock::time_point;
+  StallDetector(Duration threshold, std::function<void(Duration)> on_stall)
+      : threshold_(std::move(threshold)), on_stall_(std::move(on_stall)) {}
 
-  GlobalTimer() {
-    timer_thread_ = std::thread([this]() { TriggerLoop(); });
+  void ExpectWakeUpAt(TimePoint deadline) {
+    expected_wake_up_ = deadline;
+    is_wake_up_expected_ = true;
+  }
+
+  void CallbackIfRequired(TimePoint now) {
+    if (is_wake_up_expected_ && now - expected_wake_up_ > threshold_) {
+      on_stall_(now - expected_wake_up_);
+    }
+    is_wake_up_expected_ = false;
+  }
+
+private:
+  Duration threshold_;
+  std::function<void(Duration)> on_stall_;
+  TimePoint expected_wake_up_{};
+  bool is_wake_up_expected_{false};
+};
+
+template <typename Clock,
+          typename Schedule = HeapSchedule<typename Clock::time_point>,
+          typename Waiter = ConditionVariableWaiter<Clock>>
+class GlobalTimer {
+public:
+  using Duration = typename Clock::duration;
+  using TimePoint = typename Clock::time_point;
+
+private:
+  using ScheduledTrigger = action_graph::ScheduledTrigger<Clock>;
+  struct Control;
+
+public:
+  // Controls a registered trigger while the timer is running. The requests
+  // are queued for the timer thread, which applies them before its next
+  // pass. A handle stays usable after the timer is destroyed.
+  class TriggerHandle {
+  public:
+    TriggerHandle() = default;
+
+    // Stops the trigger and waits until its running executions are
+    // finished. Must not be called from within the callback of the trigger.
+    void Cancel() {
+      auto &scheduled_trigger = GetScheduledTrigger();
+      scheduled_trigger.trigger.Disable();
+      scheduled_trigger.trigger.WaitUntilTriggerIsFinished();
+      auto control = control_.lock();
+      if (control)
+        control->Unregister(trigger_);
+    }
+
+    // The trigger fires one new period after this call and from then on
+    // with the new period. A staggered trigger leaves its group.
+    void ChangePeriod(Duration period) {
+      GetScheduledTrigger();
+      ThrowIfNotPositive(period);
+      auto control = control_.lock();
+      if (control)
+        control->Post(
+            Command{CommandType::kChangePeriod, trigger_, period,
+                    Clock::now()});
+    }
+
+    // A paused trigger keeps its deadlines, but its fires are ignored
+    // without being counted.
+    void Pause() { GetScheduledTrigger().is_paused = true; }
+    void Resume() { GetScheduledTrigger().is_paused = false; }
+    bool IsPaused() const { return GetScheduledTrigger().is_paused; }
+
+    TriggerStatistics GetStatistics() const {
+      return GetScheduledTrigger().trigger.GetStatistics();
+    }
+
+  private:
+    friend class GlobalTimer;
+
+    TriggerHandle(std::shared_ptr<ScheduledTrigger> trigger,
+                  std::weak_ptr<Control> control)
+        : trigger_(std::move(trigger)), control_(std::move(control)) {}
+
+    ScheduledTrigger &GetScheduledTrigger() const {
+      if (!trigger_)
+        throw std::logic_error("The TriggerHandle is empty.");
+      return *trigger_;
+    }
+
+    std::shared_ptr<ScheduledTrigger> trigger_{};
+    std::weak_ptr<Control> control_{};
   };
 
+  GlobalTimer() : GlobalTimer(GlobalTimerOptions{}) {}
+
+  // The callbacks are executed on a pool of worker_count threads owned by
+  // the timer.
+  explicit GlobalTimer(std::size_t worker_count)
+      : GlobalTimer(WithWorkerCount(worker_count)) {}
+
+  explicit GlobalTimer(GlobalTimerOptions options)
+      : owned_worker_pool_(std::make_unique<executors::ThreadPool>(
+            options.worker_count, options.worker_threads)),
+        worker_pool_(*owned_worker_pool_), options_(std::move(options)) {
+    StartTimerThread();
+  }
+
+  // The callbacks are executed on the given executor, which has to outlive
+  // the timer.
+  explicit GlobalTimer(executors::Executor &worker_pool,
+                       GlobalTimerOptions options = {})
+      : worker_pool_(worker_pool), options_(std::move(options)) {
+    StartTimerThread();
+  }
+
   ~GlobalTimer() {
-    is_timer_thread_running_ = false;
-    if (timer_thread_.joinable())
-      timer_thread_.join();
+    {
+      std::lock_guard<std::mutex> lock(control_->wake_up_mutex);
+      control_->is_running = false;
+    }
+    control_->waiter.NotifyAll();
+    if (timer_thread_.Joinable())
+      timer_thread_.Join();
   };
 
-  void SetTriggerTime(Duration period, std::function<void()> callback) {
-    std::lock_guard<std::mutex> lock(schedule_mutex_);
-    const auto now = Clock::now();
-    auto next_trigger_time_point = now + period;
-    schedule_.emplace_back(period, std::move(callback),
-                           std::move(next_trigger_time_point));
+  TriggerHandle SetTriggerTime(Duration period, std::function<void()> callback,
+                               TriggerOptions options = {}) {
+    ThrowIfNotPositive(period);
+    const bool is_staggered = options_.stagger_triggers && !options.has_phase;
+    auto scheduled_trigger = std::make_shared<ScheduledTrigger>(
+        period, is_staggered, std::move(callback), std::move(options),
+        options_.trigger_histograms);
+    control_->Register(scheduled_trigger);
+    control_->Post(
+        Command{CommandType::kAdd, scheduled_trigger, period, Clock::now()});
+    return TriggerHandle(std::move(scheduled_trigger), control_);
   }
 
+  // Returns after a complete pass of the timer loop, which has read the
+  // clock after this call, and after all callbacks are finished.
   void WaitOneCycle() {
-    if (!is_timer_thread_running_)
-      throw std::logic_error("GlobalTimer is not running.");
-    // locking the mutex makes sure, that the currently running loop is
-    // finished before we wait for the next cycle
-    std::unique_lock<std::mutex> lock(schedule_mutex_);
-    // There is a tiny chance, that the first
-    // conditional_variable.notify_all() is called from the timer loop which
-    // was already executed before we called WaitOneCycle(). Therefore, we
-    // wait until two loops are finished.
-    loop_conditional_variable_.wait(lock);
-    loop_conditional_variable_.wait(lock);
-    for (auto &scheduled_trigger : schedule_) {
-      scheduled_trigger.trigger.WaitUntilTriggerIsFinished();
+    {
+      std::unique_lock<std::mutex> lock(control_->wake_up_mutex);
+      if (!control_->is_running)
+        throw std::logic_error("GlobalTimer is not running.");
+      const auto awaited_cycle = ++control_->requested_cycles;
+      control_->waiter.NotifyAll();
+      control_->loop_conditional_variable.wait(
+          lock, [this, awaited_cycle]() {
+            return control_->completed_cycles >= awaited_cycle ||
+                   !control_->is_running;
+          });
+    }
+    for (auto &scheduled_trigger : control_->RegisteredTriggers()) {
+      scheduled_trigger->trigger.WaitUntilTriggerIsFinished();
+    }
+  }
+
+  // The statistics of all triggers in the order of registration.
+  std::vector<NamedTriggerStatistics> GetTriggerStatistics() {
+    const auto triggers = control_->RegisteredTriggers();
+    std::vector<NamedTriggerStatistics> statistics;
+    statistics.reserve(triggers.size());
+    for (const auto &scheduled_trigger : triggers) {
+      statistics.push_back({scheduled_trigger->name,
+                            scheduled_trigger->trigger.GetStatistics()});
+    }
+    return statistics;
+  }
+
+  // Whether the timer thread and the workers owned by the timer applied
+  // their ThreadConfiguration, e.g. false, if real-time scheduling was not
+  // permitted.
+  bool AreThreadsConfigured() const {
+    return timer_thread_.IsConfigurationApplied() &&
+           (owned_worker_pool_ == nullptr ||
+            owned_worker_pool_->AreWorkersConfigured());
+  }
+
+  WakeUpStatistics GetWakeUpStatistics() const {
+    std::lock_guard<std::mutex> lock(wake_up_statistics_mutex_);
+    WakeUpStatistics statistics;
+    statistics.count = wake_up_count_;
+    if (wake_up_count_ > 0)
+      statistics.mean_error = std::chrono::nanoseconds{
+          total_wake_up_error_ /
+          static_cast<std::chrono::nanoseconds::rep>(wake_up_count_)};
+    statistics.max_error = std::chrono::nanoseconds{max_wake_up_error_};
+    statistics.spin_slack = std::chrono::nanoseconds{spin_slack_.load()};
+    return statistics;
+  }
+
+  // Copies the measurements, which are recorded without taking a lock.
+  TimerInstrumentation GetInstrumentation() const {
+    TimerInstrumentation instrumentation;
+    instrumentation.loop_passes = loop_passes_.load();
+    const std::chrono::duration<double> running_time =
+        std::chrono::steady_clock::now() - start_time_;
+    if (running_time.count() > 0.0)
+      instrumentation.loop_passes_per_second =
+          static_cast<double>(instrumentation.loop_passes) /
+          running_time.count();
+    instrumentation.pass_duration = pass_duration_.Snapshot();
+    instrumentation.lock_wait = lock_wait_.Snapshot();
+    for (const auto &scheduled_trigger : control_->RegisteredTriggers()) {
+      instrumentation.triggers.push_back(scheduled_trigger->Instrumentation());
     }
+    return instrumentation;
   }
 
+  // The number of passes of the timer loop, which were detected as stalled.
+  std::size_t GetStallCount() const noexcept { return stall_count_.load(); }
+
 private:
-  struct ScheduledTrigger {
-    ScheduledTrigger(Duration period, std::function<void()> callback,
-                     TimePoint next_trigger_time_point)
-        : period(std::move(period)), trigger(std::move(callback)),
-          next_trigger_time_point(std::move(next_trigger_time_point)) {}
-    const Duration period;
-    Trigger trigger;
-    TimePoint next_trigger_time_point;
+  enum class CommandType { kAdd, kChangePeriod, kRemove };
+
+  struct Command {
+    CommandType type;
+    std::shared_ptr<ScheduledTrigger> scheduled_trigger;
+    Duration period;
+    TimePoint time_point;
   };
 
+  // The state shared by the timer and its trigger handles. Only the timer
+  // thread touches the schedule, all other threads post commands to it.
+  struct Control {
+    void Post(Command command) {
+      commands.Push(std::move(command));
+      // pairs with the check of the queue before the timer thread sleeps
+      { std::lock_guard<std::mutex> lock(wake_up_mutex); }
+      waiter.NotifyAll();
+    }
+
+    void Register(const std::shared_ptr<ScheduledTrigger> &scheduled_trigger) {
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      registry.push_back(scheduled_trigger);
+    }
+
+    void
+    Unregister(const std::shared_ptr<ScheduledTrigger> &scheduled_trigger) {
+      {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        const auto position =
+            std::find(registry.begin(), registry.end(), scheduled_trigger);
+        if (position == registry.end())
+          return;
+        registry.erase(position);
+      }
+      Post(Command{CommandType::kRemove, scheduled_trigger, Duration{},
+                   TimePoint{}});
+    }
+
+    std::vector<std::shared_ptr<ScheduledTrigger>> RegisteredTriggers() {
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      return registry;
+    }
+
+    CommandQueue<Command> commands{};
+
+    std::mutex wake_up_mutex{};
+    Waiter waiter{};
+    std::condition_variable loop_conditional_variable{};
+    bool is_running{true};
+    std::size_t requested_cycles{0};
+    std::size_t completed_cycles{0};
+
+    std::mutex registry_mutex{};
+    std::vector<std::shared_ptr<ScheduledTrigger>> registry{};
+  };
+
+  static GlobalTimerOptions WithWorkerCount(std::size_t worker_count) {
+    GlobalTimerOptions options;
+    options.worker_count = worker_count;
+    return options;
+  }
+
+  void StartTimerThread() {
+    timer_thread_ = executors::ConfiguredThread(options_.timer_thread,
+                                                [this]() { TriggerLoop(); });
+  }
+
+  static std::chrono::nanoseconds NowSinceEpoch() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch());
+  }
+
+  static void ThrowIfNotPositive(const Duration &period) {
+    if (period <= Duration::zero())
+      throw std::invalid_argument(
+          "The period of a trigger has to be positive.");
+  }
+
+  void ApplyCommands() {
+    control_->commands.ConsumeAll([this](Command &command) {
+      switch (command.type) {
+      case CommandType::kAdd:
+        scheduler_.Add(std::move(command.scheduled_trigger),
+                       command.time_point);
+        break;
+      case CommandType::kChangePeriod:
+        scheduler_.ChangePeriod(*command.scheduled_trigger, command.period,
+                                command.time_point);
+        break;
+      case CommandType::kRemove:
+        scheduler_.Remove(*command.scheduled_trigger);
+        break;
+      }
+    });
+  }
+
   void TriggerLoop() {
+    if (options_.precision == TimerPrecision::kSleepThenSpin) {
+      spin_slack_ = options_.spin_slack > std::chrono::nanoseconds::zero()
+                        ? options_.spin_slack.count()
+                        : MeasureSleepOvershoot().count();
+    }
     JumpToPastDetector<Clock> jump_detector(
         Clock::now(),
         [this](const TimePoint &now) { HandleClockJumpBackwards(now); });
+    StallDetector<Clock> stall_detector(
+        std::chrono::duration_cast<Duration>(options_.stall_threshold),
+        [this](const Duration &delay) { HandleStall(delay); });
+
+    std::unique_lock<std::mutex> lock(control_->wake_up_mutex);
+    while (control_->is_running) {
+      // every cycle requested up to here is served by this pass
+      const auto served_cycles = control_->requested_cycles;
+      lock.unlock();
 
-    while (is_timer_thread_running_) {
+      const auto pass_start = std::chrono::steady_clock::now();
+      ApplyCommands();
       const auto now = Clock::now();
+      RecordWakeUp(now);
       jump_detector.CallbackIfRequired(now);
-      TriggerIfReached(now);
-      loop_conditional_variable_.notify_all();
+      stall_detector.CallbackIfRequired(now);
+      scheduler_.FireDue(now, &worker_pool_);
+      const auto pass_end = std::chrono::steady_clock::now();
+      pass_duration_.Record(pass_end - pass_start);
+      ++loop_passes_;
+
+      lock.lock();
+      lock_wait_.Record(std::chrono::steady_clock::now() - pass_end);
+      control_->completed_cycles = served_cycles;
+      control_->loop_conditional_variable.notify_all();
+      if (!scheduler_.IsEmpty())
+        stall_detector.ExpectWakeUpAt(
+            std::max(scheduler_.EarliestDeadline(), now));
+      SleepUntilNextTrigger(lock);
     }
+    control_->loop_conditional_variable.notify_all();
   }
 
-  void TriggerIfReached(const TimePoint &now) {
-    std::lock_guard<std::mutex> lock(schedule_mutex_);
-    for (auto &trigger : schedule_) {
-      if (now >= trigger.next_trigger_time_point) {
-        trigger.trigger.TriggerAsynchronously();
-        trigger.next_trigger_time_point += trigger.period;
-      }
+  void SleepUntilNextTrigger(std::unique_lock<std::mutex> &lock) {
+    const auto is_awake = [this]() {
+      return !control_->is_running || !control_->commands.IsEmpty() ||
+             control_->requested_cycles > control_->completed_cycles;
+    };
+    if (scheduler_.IsEmpty()) {
+      is_deadline_awaited_ = false;
+      control_->waiter.Wait(lock, is_awake);
+      return;
+    }
+    const auto deadline = scheduler_.EarliestDeadline();
+    awaited_deadline_ = deadline;
+    is_deadline_awaited_ = true;
+    if (options_.precision == TimerPrecision::kSleep) {
+      control_->waiter.WaitUntil(lock, deadline, is_awake);
+      return;
     }
+    const auto spin_slack = std::chrono::duration_cast<Duration>(
+        std::chrono::nanoseconds{spin_slack_.load()});
+    control_->waiter.WaitUntil(lock, deadline - spin_slack, is_awake);
+    if (is_awake())
+      return;
+    lock.unlock();
+    while (Clock::now() < deadline) {
+    }
+    lock.lock();
+  }
+
+  // Only wake-ups at or after the awaited deadline are counted, earlier
+  // ones were caused by a notification.
+  void RecordWakeUp(const TimePoint &now) {
+    if (!is_deadline_awaited_ || now < awaited_deadline_)
+      return;
+    is_deadline_awaited_ = false;
+    const auto error = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           now - awaited_deadline_)
+                           .count();
+    std::lock_guard<std::mutex> lock(wake_up_statistics_mutex_);
+    ++wake_up_count_;
+    total_wake_up_error_ += error;
+    max_wake_up_error_ = std::max(max_wake_up_error_, error);
+  }
+
+  void HandleStall(const Duration &delay) {
+    ++stall_count_;
+    if (options_.on_stall)
+      options_.on_stall(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(delay));
   }
 
   void HandleClockJumpBackwards(const TimePoint &now) {
-    std::lock_guard<std::mutex> lock(schedule_mutex_);
-    for (auto &trigger : schedule_) {
-      trigger.next_trigger_time_point = now + trigger.period;
-    }
+    scheduler_.RestartAt(now);
   }
 
-  std::thread timer_thread_;
-  std::atomic<bool> is_timer_thread_running_{true};
-  std::mutex schedule_mutex_{};
-  std::condition_variable loop_conditional_variable_{};
-  std::vector<ScheduledTrigger> schedule_{};
+  // declared first, so that the workers outlive all triggers
+  std::unique_ptr<executors::ThreadPool> owned_worker_pool_{};
+  executors::Executor &worker_pool_;
+  const GlobalTimerOptions options_;
+  std::shared_ptr<Control> control_{std::make_shared<Control>()};
+  std::atomic<std::size_t> stall_count_{0};
+  std::atomic<std::chrono::nanoseconds::rep> spin_slack_{0};
+
+  const std::chrono::steady_clock::time_point start_time_{
+      std::chrono::steady_clock::now()};
+  std::atomic<std::uint64_t> loop_passes_{0};
+  LatencyHistogram pass_duration_{};
+  LatencyHistogram lock_wait_{};
+
+  // owned by the timer thread
+  TimePoint awaited_deadline_{};
+  bool is_deadline_awaited_{false};
+
+  mutable std::mutex wake_up_statistics_mutex_{};
+  std::uint64_t wake_up_count_{0};
+  std::chrono::nanoseconds::rep total_wake_up_error_{0};
+  std::chrono::nanoseconds::rep max_wake_up_error_{0};
+
+  // owned by the timer thread
+  TriggerScheduler<Clock, Schedule> scheduler_{options_.dispatch_policy,
+                                               &NowSinceEpoch};
+
+  // declared last, so that the loop starts after all members are constructed
+  executors::ConfiguredThread timer_thread_{};
 };
 } // namespace action_graph
 
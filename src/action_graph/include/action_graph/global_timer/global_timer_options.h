@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_GLOBAL_TIMER_OPTIONS_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_GLOBAL_TIMER_OPTIONS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+#include <action_graph/executors/thread_configuration.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/global_timer/precision.h>
+
+namespace action_graph {
+
+// Decides in which order the triggers, which are due in the same pass of the
+// timer loop, are handed to the workers.
+enum class DispatchPolicy {
+  // In the order of their deadlines in the schedule and, for equal ones, of
+  // their registration. The pool starts them in the order they are posted.
+  kFifo,
+  // Ordered by the absolute deadline of the execution, i.e. the deadline of
+  // the fire plus the relative deadline of the trigger. The pool starts them
+  // earliest deadline first, before any task posted without a deadline.
+  kEarliestDeadlineFirst
+};
+
+struct GlobalTimerOptions {
+  // Size of the worker pool, if the timer owns it.
+  std::size_t worker_count{executors::ThreadPool::DefaultThreadCount()};
+  // Spreads the triggers which share a period and have no explicit phase
+  // evenly across that period.
+  bool stagger_triggers{false};
+  // The timer loop counts as stalled, if it runs later than the deadline it
+  // slept for by more than this, e.g. after the process was suspended or the
+  // clock jumped forward.
+  std::chrono::nanoseconds stall_threshold{std::chrono::milliseconds{100}};
+  // Called on the timer thread with the delay of the stalled pass.
+  std::function<void(std::chrono::nanoseconds)> on_stall{};
+  TimerPrecision precision{TimerPrecision::kSleep};
+  // Used by TimerPrecision::kSleepThenSpin. Zero measures the sleep
+  // overshoot of the host when the timer starts.
+  std::chrono::nanoseconds spin_slack{0};
+  DispatchPolicy dispatch_policy{DispatchPolicy::kFifo};
+  // Records a histogram of the fire lateness and one of the run time for
+  // every trigger. Together they take about 9.5 kB per trigger, so that they
+  // are off by default and the instrumentation reports them empty.
+  bool trigger_histograms{false};
+  executors::ThreadConfiguration timer_thread{};
+  // Only used, if the timer owns the worker pool.
+  executors::ThreadConfiguration worker_threads{};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_GLOBAL_TIMER_OPTIONS_H_
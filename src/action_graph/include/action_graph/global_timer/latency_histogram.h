@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_LATENCY_HISTOGRAM_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_LATENCY_HISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace action_graph {
+
+struct LatencyHistogramSnapshot {
+  std::uint64_t count{0};
+  std::chrono::nanoseconds mean{0};
+  std::chrono::nanoseconds max{0};
+  std::vector<std::uint64_t> bucket_counts{};
+
+  // The upper bound of the bucket which contains the given percentile, at
+  // most the maximum. Zero for an empty histogram.
+  std::chrono::nanoseconds Percentile(double percentile) const;
+};
+
+// Counts durations in log-linear buckets like an HDR histogram. Every power
+// of two range of nanoseconds is split into kSubBucketCount linear buckets,
+// so the relative error of a bucket is below 1 / kSubBucketCount. Recording
+// is lock-free and wait-free apart from the maximum.
+class LatencyHistogram {
+public:
+  static constexpr std::size_t kSubBucketBits = 4;
+  static constexpr std::size_t kSubBucketCount = std::size_t{1}
+                                                 << kSubBucketBits;
+  // Durations from 2^kMaximumExponent nanoseconds on, about 18 minutes,
+  // share the last bucket.
+  static constexpr std::size_t kMaximumExponent = 40;
+  static constexpr std::size_t kBucketCount =
+      (kMaximumExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+  // Negative durations are counted as zero.
+  void Record(std::chrono::nanoseconds duration) noexcept;
+
+  LatencyHistogramSnapshot Snapshot() const;
+
+  static std::size_t BucketIndex(std::uint64_t nanoseconds) noexcept;
+  static std::uint64_t BucketUpperBound(std::size_t index) noexcept;
+
+private:
+  std::array<std::atomic<std::uint64_t>, kBucketCount> bucket_counts_{};
+  std::atomic<std::uint64_t> count_{0};
+  std::atomic<std::uint64_t> total_{0};
+  std::atomic<std::uint64_t> max_{0};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_PRECISION_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_PRECISION_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace action_graph {
+
+enum class TimerPrecision {
+  // The timer thread sleeps until the next deadline.
+  kSleep,
+  // The timer thread sleeps until the spin slack before the next deadline
+  // and spins for the rest. This trades CPU time for a lower wake-up error.
+  kSleepThenSpin
+};
+
+// How late the timer thread woke up for the deadlines it waited for.
+struct WakeUpStatistics {
+  std::uint64_t count{0};
+  std::chrono::nanoseconds mean_error{0};
+  std::chrono::nanoseconds max_error{0};
+  std::chrono::nanoseconds spin_slack{0};
+};
+
+// Measures how much later than requested the host wakes up a sleeping
+// thread. Returns the 90th percentile of a series of short sleeps.
+std::chrono::nanoseconds MeasureSleepOvershoot();
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_PRECISION_H_
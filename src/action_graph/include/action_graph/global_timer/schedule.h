@@ -0,0 +1,201 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SCHEDULE_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SCHEDULE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace action_graph {
+
+template <typename TimePoint> struct ScheduleEntry {
+  TimePoint deadline;
+  std::size_t id;
+};
+
+template <typename TimePoint>
+bool IsEarlier(const ScheduleEntry<TimePoint> &lhs,
+               const ScheduleEntry<TimePoint> &rhs) {
+  if (lhs.deadline != rhs.deadline)
+    return lhs.deadline < rhs.deadline;
+  return lhs.id < rhs.id;
+}
+
+// Keeps the entries in registration order and scans all of them on every
+// pass. Finding the due entries costs O(n).
+template <typename TimePoint> class LinearSchedule {
+public:
+  using Entry = ScheduleEntry<TimePoint>;
+
+  void Insert(std::size_t id, TimePoint deadline) {
+    entries_.push_back(Entry{deadline, id});
+  }
+
+  bool IsEmpty() const noexcept { return entries_.empty(); }
+
+  std::size_t Size() const noexcept { return entries_.size(); }
+
+  TimePoint EarliestDeadline() const {
+    if (entries_.empty())
+      throw std::logic_error("The schedule is empty.");
+    return std::min_element(entries_.begin(), entries_.end(),
+                            IsEarlier<TimePoint>)
+        ->deadline;
+  }
+
+  // Calls fire for every entry with a deadline not after now. fire has to
+  // move the deadline of the entry to its next occurrence and returns false,
+  // if the entry shall be removed.
+  template <typename Fire> void FireDue(const TimePoint &now, Fire fire) {
+    auto kept = entries_.begin();
+    for (auto &entry : entries_) {
+      if (entry.deadline > now || fire(entry)) {
+        *kept++ = entry;
+      }
+    }
+    entries_.erase(kept, entries_.end());
+  }
+
+  // Moves the entry with the id to the deadline.
+  void Update(std::size_t id, TimePoint deadline) {
+    const auto entry = std::find_if(
+        entries_.begin(), entries_.end(),
+        [id](const Entry &candidate) { return candidate.id == id; });
+    if (entry == entries_.end())
+      throw std::logic_error("The id is not in the schedule.");
+    entry->deadline = deadline;
+  }
+
+  template <typename Update> void UpdateAll(Update update) {
+    for (auto &entry : entries_) {
+      update(entry);
+    }
+  }
+
+private:
+  std::vector<Entry> entries_{};
+};
+
+// Binary min-heap ordered by deadline. Taking the k due entries costs
+// O(k log n), the earliest deadline is available in O(1). The heap knows the
+// position of every id, so that a single entry is moved in O(log n).
+template <typename TimePoint> class HeapSchedule {
+public:
+  using Entry = ScheduleEntry<TimePoint>;
+
+  void Insert(std::size_t id, TimePoint deadline) {
+    if (positions_.size() <= id)
+      positions_.resize(id + 1, kNotInHeap);
+    heap_.push_back(Entry{deadline, id});
+    positions_[id] = heap_.size() - 1;
+    SiftUp(heap_.size() - 1);
+  }
+
+  bool IsEmpty() const noexcept { return heap_.empty(); }
+
+  std::size_t Size() const noexcept { return heap_.size(); }
+
+  TimePoint EarliestDeadline() const {
+    if (heap_.empty())
+      throw std::logic_error("The schedule is empty.");
+    return heap_.front().deadline;
+  }
+
+  // Calls fire for every entry with a deadline not after now, earliest
+  // first. fire has to move the deadline of the entry to its next
+  // occurrence and returns false, if the entry shall be removed. Each entry
+  // is fired at most once per call.
+  template <typename Fire> void FireDue(const TimePoint &now, Fire fire) {
+    due_.clear();
+    while (!heap_.empty() && heap_.front().deadline <= now) {
+      due_.push_back(heap_.front());
+      positions_[heap_.front().id] = kNotInHeap;
+      MoveLastTo(0);
+    }
+    for (auto &entry : due_) {
+      if (fire(entry))
+        Insert(entry.id, entry.deadline);
+    }
+  }
+
+  // Moves the entry with the id to the deadline.
+  void Update(std::size_t id, TimePoint deadline) {
+    if (id >= positions_.size() || positions_[id] == kNotInHeap)
+      throw std::logic_error("The id is not in the schedule.");
+    const auto position = positions_[id];
+    heap_[position].deadline = deadline;
+    SiftUp(position);
+    SiftDown(positions_[id]);
+  }
+
+  template <typename Update> void UpdateAll(Update update) {
+    for (auto &entry : heap_) {
+      update(entry);
+    }
+    for (auto position = heap_.size() / 2; position > 0; --position) {
+      SiftDown(position - 1);
+    }
+  }
+
+private:
+  static constexpr std::size_t kNotInHeap = static_cast<std::size_t>(-1);
+
+  // Removes the entry at the position by moving the last entry into its
+  // place.
+  void MoveLastTo(std::size_t position) {
+    heap_[position] = heap_.back();
+    heap_.pop_back();
+    if (position == heap_.size())
+      return;
+    positions_[heap_[position].id] = position;
+    SiftDown(position);
+  }
+
+  void SiftUp(std::size_t position) {
+    while (position > 0) {
+      const auto parent = (position - 1) / 2;
+      if (!IsEarlier(heap_[position], heap_[parent]))
+        return;
+      Swap(position, parent);
+      position = parent;
+    }
+  }
+
+  void SiftDown(std::size_t position) {
+    while (true) {
+      auto earliest = position;
+      for (auto child = 2 * position + 1;
+           child < std::min(2 * position + 3, heap_.size()); ++child) {
+        if (IsEarlier(heap_[child], heap_[earliest]))
+          earliest = child;
+      }
+      if (earliest == position)
+        return;
+      Swap(position, earliest);
+      position = earliest;
+    }
+  }
+
+  void Swap(std::size_t lhs, std::size_t rhs) {
+    std::swap(heap_[lhs], heap_[rhs]);
+    positions_[heap_[lhs].id] = lhs;
+    positions_[heap_[rhs].id] = rhs;
+  }
+
+  std::vector<Entry> heap_{};
+  // indexed by the ids
+  std::vector<std::size_t> positions_{};
+  std::vector<Entry> due_{};
+};
+
+template <typename TimePoint>
+constexpr std::size_t HeapSchedule<TimePoint>::kNotInHeap;
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SCHEDULE_H_
@@ -0,0 +1,179 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SHARDED_TIMER_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SHARDED_TIMER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/global_timer/global_timer.h>
+#include <action_graph/global_timer/global_timer_options.h>
+#include <action_graph/global_timer/trigger_options.h>
+
+namespace action_graph {
+
+enum class ShardingStrategy {
+  // Triggers whose periods are within the same power of two share a shard,
+  // so that triggers with the same period can still be staggered.
+  kByPeriodClass,
+  // Triggers are distributed by the hash of their name. Unnamed triggers are
+  // distributed in the order of registration.
+  kByHash
+};
+
+struct ShardedTimerOptions {
+  std::size_t shard_count{2};
+  ShardingStrategy sharding_strategy{ShardingStrategy::kByPeriodClass};
+  // Used by every shard. The shards share one worker pool. The name of the
+  // timer thread gets the index of the shard appended.
+  GlobalTimerOptions timer_options{};
+  // Shard i is pinned to shard_cpus[i % shard_cpus.size()], if not empty.
+  std::vector<std::size_t> shard_cpus{};
+};
+
+// Partitions the triggers across several GlobalTimers, each with its own
+// timer thread, schedule and wake-up mechanism.
+template <typename Clock,
+          typename Schedule = HeapSchedule<typename Clock::time_point>,
+          typename Waiter = ConditionVariableWaiter<Clock>>
+class ShardedTimer {
+public:
+  using Shard = GlobalTimer<Clock, Schedule, Waiter>;
+  using Duration = typename Shard::Duration;
+  using TimePoint = typename Shard::TimePoint;
+  using TriggerHandle = typename Shard::TriggerHandle;
+
+  ShardedTimer() : ShardedTimer(ShardedTimerOptions{}) {}
+
+  explicit ShardedTimer(ShardedTimerOptions options)
+      : owned_worker_pool_(std::make_unique<executors::ThreadPool>(
+            options.timer_options.worker_count,
+            options.timer_options.worker_threads)),
+        worker_pool_(*owned_worker_pool_),
+        sharding_strategy_(options.sharding_strategy) {
+    CreateShards(options);
+  }
+
+  // All shards execute the callbacks on the given executor, which has to
+  // outlive the timer.
+  explicit ShardedTimer(executors::Executor &worker_pool,
+                        ShardedTimerOptions options = {})
+      : worker_pool_(worker_pool),
+        sharding_strategy_(options.sharding_strategy) {
+    CreateShards(options);
+  }
+
+  TriggerHandle SetTriggerTime(Duration period, std::function<void()> callback,
+                               TriggerOptions options = {}) {
+    auto &shard = *shards_[ShardIndex(period, options)];
+    ++registered_triggers_;
+    return shard.SetTriggerTime(period, std::move(callback),
+                                std::move(options));
+  }
+
+  // Waits for one cycle of every shard.
+  void WaitOneCycle() {
+    for (auto &shard : shards_) {
+      shard->WaitOneCycle();
+    }
+  }
+
+  // The statistics of all triggers, grouped by shard.
+  std::vector<NamedTriggerStatistics> GetTriggerStatistics() {
+    std::vector<NamedTriggerStatistics> statistics;
+    for (auto &shard : shards_) {
+      const auto shard_statistics = shard->GetTriggerStatistics();
+      statistics.insert(statistics.end(), shard_statistics.begin(),
+                        shard_statistics.end());
+    }
+    return statistics;
+  }
+
+  // The measurements of every shard.
+  std::vector<TimerInstrumentation> GetInstrumentation() const {
+    std::vector<TimerInstrumentation> instrumentation;
+    instrumentation.reserve(shards_.size());
+    for (const auto &shard : shards_) {
+      instrumentation.push_back(shard->GetInstrumentation());
+    }
+    return instrumentation;
+  }
+
+  std::size_t GetStallCount() const noexcept {
+    std::size_t stall_count = 0;
+    for (const auto &shard : shards_) {
+      stall_count += shard->GetStallCount();
+    }
+    return stall_count;
+  }
+
+  std::size_t ShardCount() const noexcept { return shards_.size(); }
+
+  Shard &GetShard(std::size_t index) { return *shards_.at(index); }
+
+  // The shard the next trigger with this period and options is assigned to.
+  std::size_t ShardIndex(const Duration &period,
+                         const TriggerOptions &options) const {
+    if (sharding_strategy_ == ShardingStrategy::kByPeriodClass)
+      return PeriodClass(period) % shards_.size();
+    if (options.name.empty())
+      return registered_triggers_ % shards_.size();
+    return std::hash<std::string>{}(options.name) % shards_.size();
+  }
+
+private:
+  void CreateShards(const ShardedTimerOptions &options) {
+    if (options.shard_count == 0)
+      throw std::invalid_argument("A ShardedTimer needs at least one shard.");
+    shards_.reserve(options.shard_count);
+    for (std::size_t index = 0; index < options.shard_count; ++index) {
+      shards_.push_back(
+          std::make_unique<Shard>(worker_pool_, ShardOptions(options, index)));
+    }
+  }
+
+  static GlobalTimerOptions ShardOptions(const ShardedTimerOptions &options,
+                                         std::size_t index) {
+    auto shard_options = options.timer_options;
+    auto &thread = shard_options.timer_thread;
+    if (!thread.name.empty())
+      thread.name += std::to_string(index);
+    if (!options.shard_cpus.empty())
+      thread.cpu_affinity = {
+          options.shard_cpus[index % options.shard_cpus.size()]};
+    return shard_options;
+  }
+
+  // The position of the highest set bit of the period in nanoseconds.
+  static std::size_t PeriodClass(const Duration &period) {
+    auto nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(period).count();
+    std::size_t period_class = 0;
+    while (nanoseconds > 1) {
+      nanoseconds >>= 1;
+      ++period_class;
+    }
+    return period_class;
+  }
+
+  // declared first, so that the workers outlive all shards
+  std::unique_ptr<executors::ThreadPool> owned_worker_pool_{};
+  executors::Executor &worker_pool_;
+  const ShardingStrategy sharding_strategy_;
+  std::atomic<std::size_t> registered_triggers_{0};
+  std::vector<std::unique_ptr<Shard>> shards_{};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SHARDED_TIMER_H_
@@ -0,0 +1,287 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SIMULATED_TIMER_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SIMULATED_TIMER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/global_timer/global_timer_options.h>
+#include <action_graph/global_timer/latency_histogram.h>
+#include <action_graph/global_timer/schedule.h>
+#include <action_graph/global_timer/timer_instrumentation.h>
+#include <action_graph/global_timer/trigger.h>
+#include <action_graph/global_timer/trigger_options.h>
+#include <action_graph/global_timer/trigger_scheduler.h>
+
+namespace action_graph {
+
+// Replays the schedule of a GlobalTimer in virtual time. There is no timer
+// thread: the virtual clock jumps straight to the next deadline, all
+// triggers due at that instant are fired, and the clock only advances after
+// their callbacks are finished. Hours of schedule replay as fast as the
+// callbacks run, and the order of the fires does not depend on the thread
+// scheduling of the host.
+//
+// Clock only provides the duration and time point types, the virtual time
+// starts at the epoch of the clock. The triggers are scheduled by the same
+// TriggerScheduler as on a GlobalTimer, which is never late, so phases,
+// tolerances and staggering replay exactly, while the catch-up policies
+// never skip a deadline. The callbacks take no virtual time, so that an
+// execution only misses its deadline, if the trigger fires later than the
+// deadline, e.g. within a tolerance longer than the deadline. Of the
+// GlobalTimerOptions only
+// stagger_triggers, dispatch_policy and trigger_histograms are used. The
+// timer has to be driven from a single thread and must not be used anymore
+// after a callback threw an exception.
+template <typename Clock,
+          typename Schedule = HeapSchedule<typename Clock::time_point>>
+class SimulatedTimer {
+public:
+  using Duration = typename Clock::duration;
+  using TimePoint = typename Clock::time_point;
+
+private:
+  using ScheduledTrigger = action_graph::ScheduledTrigger<Clock>;
+  struct Control;
+
+public:
+  // Controls a registered trigger. A request from within a callback is
+  // applied after the current instant was fired. A handle stays usable
+  // after the timer is destroyed.
+  class TriggerHandle {
+  public:
+    TriggerHandle() = default;
+
+    // The trigger is not fired anymore. Running executions are not waited
+    // for, so the handle may be used within the callback of the trigger.
+    void Cancel() {
+      GetScheduledTrigger().trigger.Disable();
+      auto control = control_.lock();
+      if (control)
+        control->timer.Post(Command{CommandType::kRemove, trigger_, {}});
+    }
+
+    // The trigger fires one new period after the current virtual time and
+    // from then on with the new period. A staggered trigger leaves its
+    // group.
+    void ChangePeriod(Duration period) {
+      GetScheduledTrigger();
+      ThrowIfNotPositive(period);
+      auto control = control_.lock();
+      if (control)
+        control->timer.Post(
+            Command{CommandType::kChangePeriod, trigger_, period});
+    }
+
+    // A paused trigger keeps its deadlines, but its fires are ignored
+    // without being counted.
+    void Pause() { GetScheduledTrigger().is_paused = true; }
+    void Resume() { GetScheduledTrigger().is_paused = false; }
+    bool IsPaused() const { return GetScheduledTrigger().is_paused; }
+
+    TriggerStatistics GetStatistics() const {
+      return GetScheduledTrigger().trigger.GetStatistics();
+    }
+
+  private:
+    friend class SimulatedTimer;
+
+    TriggerHandle(std::shared_ptr<ScheduledTrigger> trigger,
+                  std::weak_ptr<Control> control)
+        : trigger_(std::move(trigger)), control_(std::move(control)) {}
+
+    ScheduledTrigger &GetScheduledTrigger() const {
+      if (!trigger_)
+        throw std::logic_error("The TriggerHandle is empty.");
+      return *trigger_;
+    }
+
+    std::shared_ptr<ScheduledTrigger> trigger_{};
+    std::weak_ptr<Control> control_{};
+  };
+
+  // The callbacks run inline on the thread driving the timer.
+  explicit SimulatedTimer(GlobalTimerOptions options = {})
+      : options_(std::move(options)) {}
+
+  // The callbacks due at the same instant run concurrently on the executor,
+  // which has to outlive the timer, or on the executors and dedicated
+  // threads of their triggers.
+  explicit SimulatedTimer(executors::Executor &worker_pool,
+                          GlobalTimerOptions options = {})
+      : worker_pool_(&worker_pool), options_(std::move(options)) {}
+
+  SimulatedTimer(const SimulatedTimer &) = delete;
+  SimulatedTimer &operator=(const SimulatedTimer &) = delete;
+
+  // The trigger fires for the first time one period after the current
+  // virtual time. May be called from within a callback, the trigger is
+  // scheduled after the current instant was fired.
+  TriggerHandle SetTriggerTime(Duration period, std::function<void()> callback,
+                               TriggerOptions options = {}) {
+    ThrowIfNotPositive(period);
+    const bool is_staggered = options_.stagger_triggers && !options.has_phase;
+    auto scheduled_trigger = std::make_shared<ScheduledTrigger>(
+        period, is_staggered, std::move(callback), std::move(options),
+        options_.trigger_histograms);
+    registry_.push_back(scheduled_trigger);
+    Post(Command{CommandType::kAdd, scheduled_trigger, period});
+    return TriggerHandle(std::move(scheduled_trigger), control_);
+  }
+
+  TimePoint Now() const noexcept { return now_; }
+
+  // Advances the virtual time to the next deadline and fires every trigger
+  // due then. Returns false without advancing, if no trigger is scheduled.
+  bool Step() {
+    if (scheduler_.IsEmpty())
+      return false;
+    FireAt(scheduler_.EarliestDeadline());
+    return true;
+  }
+
+  // Fires every deadline up to and including end in order and leaves the
+  // virtual time at end.
+  void RunUntil(const TimePoint &end) {
+    while (!scheduler_.IsEmpty() && scheduler_.EarliestDeadline() <= end) {
+      FireAt(scheduler_.EarliestDeadline());
+    }
+    now_ = std::max(now_, end);
+  }
+
+  void RunFor(const Duration &duration) { RunUntil(now_ + duration); }
+
+  // The statistics of all triggers in the order of registration.
+  std::vector<NamedTriggerStatistics> GetTriggerStatistics() const {
+    std::vector<NamedTriggerStatistics> statistics;
+    for (const auto &scheduled_trigger : registry_) {
+      statistics.push_back({scheduled_trigger->name,
+                            scheduled_trigger->trigger.GetStatistics()});
+    }
+    return statistics;
+  }
+
+  // A loop pass is an instant at which triggers were due, so
+  // loop_passes_per_second is the wake-up rate a GlobalTimer would need in
+  // virtual time. The pass duration and the run times are measured in real
+  // time, their sum estimates the load of the schedule. The fire lateness
+  // is in virtual time and only caused by tolerances.
+  TimerInstrumentation GetInstrumentation() const {
+    TimerInstrumentation instrumentation;
+    instrumentation.loop_passes = loop_passes_;
+    const std::chrono::duration<double> virtual_time =
+        now_.time_since_epoch();
+    if (virtual_time.count() > 0.0)
+      instrumentation.loop_passes_per_second =
+          static_cast<double>(loop_passes_) / virtual_time.count();
+    instrumentation.pass_duration = pass_duration_.Snapshot();
+    for (const auto &scheduled_trigger : registry_) {
+      instrumentation.triggers.push_back(scheduled_trigger->Instrumentation());
+    }
+    return instrumentation;
+  }
+
+private:
+  enum class CommandType { kAdd, kChangePeriod, kRemove };
+
+  struct Command {
+    CommandType type;
+    std::shared_ptr<ScheduledTrigger> scheduled_trigger;
+    Duration period;
+  };
+
+  // Lets the trigger handles reach the timer, as long as it exists.
+  struct Control {
+    SimulatedTimer &timer;
+  };
+
+  static void ThrowIfNotPositive(const Duration &period) {
+    if (period <= Duration::zero())
+      throw std::invalid_argument(
+          "The period of a trigger has to be positive.");
+  }
+
+  void Post(Command command) {
+    if (is_firing_) {
+      commands_.push_back(std::move(command));
+    } else {
+      Apply(command);
+    }
+  }
+
+  void Apply(Command &command) {
+    switch (command.type) {
+    case CommandType::kAdd:
+      scheduler_.Add(std::move(command.scheduled_trigger), now_);
+      break;
+    case CommandType::kChangePeriod:
+      scheduler_.ChangePeriod(*command.scheduled_trigger, command.period, now_);
+      break;
+    case CommandType::kRemove:
+      Remove(command.scheduled_trigger);
+      break;
+    }
+  }
+
+  void Remove(const std::shared_ptr<ScheduledTrigger> &scheduled_trigger) {
+    const auto position =
+        std::find(registry_.begin(), registry_.end(), scheduled_trigger);
+    if (position == registry_.end())
+      return;
+    registry_.erase(position);
+    scheduler_.Remove(*scheduled_trigger);
+  }
+
+  void FireAt(const TimePoint &instant) {
+    const auto pass_start = std::chrono::steady_clock::now();
+    now_ = instant;
+    is_firing_ = true;
+    scheduler_.FireDue(now_, worker_pool_);
+    if (worker_pool_ != nullptr) {
+      for (const auto &scheduled_trigger : registry_) {
+        scheduled_trigger->trigger.WaitUntilTriggerIsFinished();
+      }
+    }
+    is_firing_ = false;
+    for (auto &command : commands_) {
+      Apply(command);
+    }
+    commands_.clear();
+    pass_duration_.Record(std::chrono::steady_clock::now() - pass_start);
+    ++loop_passes_;
+  }
+
+  executors::Executor *worker_pool_{nullptr};
+  const GlobalTimerOptions options_;
+  TimePoint now_{};
+  bool is_firing_{false};
+
+  std::uint64_t loop_passes_{0};
+  LatencyHistogram pass_duration_{};
+
+  // in the order of registration
+  std::vector<std::shared_ptr<ScheduledTrigger>> registry_{};
+  // posted by a callback, applied after the current instant
+  std::vector<Command> commands_{};
+  // without a clock, the executions are checked at the virtual time they
+  // were fired at
+  TriggerScheduler<Clock, Schedule> scheduler_{options_.dispatch_policy,
+                                               nullptr};
+  std::shared_ptr<Control> control_{std::make_shared<Control>(Control{*this})};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_SIMULATED_TIMER_H_
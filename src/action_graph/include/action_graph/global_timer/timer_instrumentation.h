@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMER_INSTRUMENTATION_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMER_INSTRUMENTATION_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <action_graph/global_timer/latency_histogram.h>
+#include <action_graph/global_timer/trigger.h>
+
+namespace action_graph {
+
+struct TriggerInstrumentation {
+  std::string name;
+  TriggerStatistics statistics;
+  // How much later than its deadline the timer thread fired the trigger.
+  // Empty, unless GlobalTimerOptions::trigger_histograms is set.
+  LatencyHistogramSnapshot fire_lateness;
+  // How long the callback ran. Empty like the fire lateness.
+  LatencyHistogramSnapshot run_time;
+};
+
+// A copy of the measurements of a timer. Fire lateness is measured with the
+// clock of the timer, all other durations with std::chrono::steady_clock.
+struct TimerInstrumentation {
+  std::uint64_t loop_passes{0};
+  double loop_passes_per_second{0.0};
+  // How long a pass of the timer loop took from applying the commands to
+  // firing the due triggers.
+  LatencyHistogramSnapshot pass_duration;
+  // How long the timer loop waited for the lock it shares with the control
+  // plane.
+  LatencyHistogramSnapshot lock_wait;
+  // In the order of registration.
+  std::vector<TriggerInstrumentation> triggers;
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMER_INSTRUMENTATION_H_
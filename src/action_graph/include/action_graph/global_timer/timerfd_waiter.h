@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMERFD_WAITER_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMERFD_WAITER_H_
+
+#ifdef __linux__
+
+#include <chrono>
+#include <mutex>
+
+#include <action_graph/global_timer/global_timer.h>
+#include <action_graph/global_timer/schedule.h>
+
+namespace action_graph {
+
+// Lets the timer thread sleep in epoll_wait until a timerfd armed with an
+// absolute CLOCK_MONOTONIC deadline expires or an eventfd is notified. Only
+// supports std::chrono::steady_clock, which is based on CLOCK_MONOTONIC.
+class TimerFdWaiter {
+public:
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  TimerFdWaiter();
+  TimerFdWaiter(const TimerFdWaiter &) = delete;
+  TimerFdWaiter &operator=(const TimerFdWaiter &) = delete;
+  ~TimerFdWaiter();
+
+  template <typename IsAwake>
+  void Wait(std::unique_lock<std::mutex> &lock, IsAwake is_awake) {
+    DisarmTimer();
+    while (!is_awake()) {
+      WaitForEvents(lock);
+    }
+  }
+
+  template <typename IsAwake>
+  void WaitUntil(std::unique_lock<std::mutex> &lock, const TimePoint &deadline,
+                 IsAwake is_awake) {
+    ArmTimer(deadline);
+    while (!is_awake()) {
+      if (WaitForEvents(lock))
+        return;
+    }
+  }
+
+  void NotifyAll();
+
+private:
+  void ArmTimer(const TimePoint &deadline);
+  void DisarmTimer();
+  // Releases the lock while waiting. Returns true, if the timer expired.
+  bool WaitForEvents(std::unique_lock<std::mutex> &lock);
+
+  int epoll_fd_{-1};
+  int timer_fd_{-1};
+  int event_fd_{-1};
+};
+
+template <typename Schedule =
+              HeapSchedule<std::chrono::steady_clock::time_point>>
+using TimerFdGlobalTimer =
+    GlobalTimer<std::chrono::steady_clock, Schedule, TimerFdWaiter>;
+
+} // namespace action_graph
+
+#endif // __linux__
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TIMERFD_WAITER_H_
@@ -8,15 +8,74 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+
 namespace action_graph {
 
+// Defines what happens, if a trigger fires while its callback is still
+// running.
+enum class OverrunPolicy {
+  // The fire is dropped.
+  kSkip,
+  // The first missed fire is kept and executed right after the running
+  // callback with its own deadline, further fires are dropped.
+  kQueueOne,
+  // All missed fires are merged into a single execution right after the
+  // running callback, which gets the deadline of the latest fire.
+  kCoalesce,
+  // Up to max_concurrent_executions callbacks run at the same time, further
+  // fires are dropped.
+  kRunConcurrently
+};
+
+// Every fire is counted exactly once, either as an execution or as dropped
+// or coalesced. Deadlines skipped by a catch-up policy never fire and are
+// counted separately.
+struct TriggerStatistics {
+  std::uint64_t executed{0};
+  std::uint64_t dropped{0};
+  std::uint64_t coalesced{0};
+  std::uint64_t skipped{0};
+  // Executions which finished after the deadline of their fire. They are
+  // counted as executed, too.
+  std::uint64_t deadline_misses{0};
+};
+
+// The absolute deadline of a fire as time since the epoch of the clock,
+// which is read by now.
+struct ExecutionDeadline {
+  std::chrono::nanoseconds time_since_epoch{0};
+  // Without a clock, the deadline is not checked, unless the execution
+  // finishes at a virtual time.
+  std::chrono::nanoseconds (*now)(){nullptr};
+  // E.g. on a SimulatedTimer, whose callbacks take no virtual time.
+  bool has_virtual_finish_time{false};
+  std::chrono::nanoseconds virtual_finish_time{0};
+  // Orders the execution on the pool by its deadline instead of the order of
+  // the fires.
+  bool is_earliest_deadline_first{false};
+};
+
+class Trigger;
+
+struct BatchedFire {
+  Trigger *trigger;
+  ExecutionDeadline deadline;
+};
+
 class Trigger {
 public:
-  explicit Trigger(std::function<void()> callback);
+  explicit Trigger(std::function<void()> callback,
+                   OverrunPolicy overrun_policy = OverrunPolicy::kSkip,
+                   std::size_t max_concurrent_executions = 1);
 
   Trigger(const Trigger &) = delete;
   Trigger(Trigger &&other) noexcept;
@@ -25,12 +84,61 @@ public:
 
   ~Trigger();
 
+  // Executes the callback on a new thread, unless the overrun policy
+  // prevents it.
   void TriggerAsynchronously();
+  // Executes the callback on the pool, unless the overrun policy prevents
+  // it. A queued callback counts as running.
+  void TriggerAsynchronously(executors::Executor &pool);
+  // Like above, but counts a deadline miss, if the execution finishes after
+  // the deadline. A pending execution gets the deadline, which the overrun
+  // policy selects.
+  void TriggerAsynchronously(executors::Executor &pool,
+                             const ExecutionDeadline &deadline);
+  // Executes the callbacks of the started triggers of the batch one after
+  // the other as a single task on the pool. Each trigger applies its own
+  // overrun policy. With earliest deadline first, the task is ordered by the
+  // earliest deadline of the batch.
+  static void TriggerAsynchronously(const std::vector<BatchedFire> &batch,
+                                    executors::Executor &pool);
+  // Executes the callback on the calling thread, unless the overrun policy
+  // prevents it. An exception of the callback is passed on.
+  void TriggerSynchronously();
+  // Like above, but counts a deadline miss like TriggerAsynchronously.
+  void TriggerSynchronously(const ExecutionDeadline &deadline);
+  // Blocks without consuming CPU time until no execution is running or
+  // queued.
   void WaitUntilTriggerIsFinished() const;
+  // Later fires are ignored without being counted and a pending execution is
+  // discarded. Running executions are not interrupted.
+  void Disable();
+  void CountSkippedDeadlines(std::uint64_t count) noexcept;
+
+  TriggerStatistics GetStatistics() const noexcept;
 
 private:
+  bool TryToStart(const ExecutionDeadline &deadline);
+  bool TryToContinueWithPendingExecution(ExecutionDeadline &deadline);
+  void FinishAfterFailure();
+  void Run(ExecutionDeadline deadline);
+  static bool IsMissed(const ExecutionDeadline &deadline);
+
   std::function<void()> callback_;
-  std::atomic<bool> is_running_{false};
+  OverrunPolicy overrun_policy_;
+  std::size_t max_concurrent_executions_;
+
+  mutable std::mutex state_mutex_{};
+  mutable std::condition_variable finished_conditional_variable_{};
+  std::atomic<std::size_t> active_executions_{0};
+  bool has_pending_execution_{false};
+  ExecutionDeadline pending_deadline_{};
+  bool is_disabled_{false};
+
+  std::atomic<std::uint64_t> executed_count_{0};
+  std::atomic<std::uint64_t> dropped_count_{0};
+  std::atomic<std::uint64_t> coalesced_count_{0};
+  std::atomic<std::uint64_t> skipped_count_{0};
+  std::atomic<std::uint64_t> deadline_miss_count_{0};
 };
 
 } // namespace action_graph
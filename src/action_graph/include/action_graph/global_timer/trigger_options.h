@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_OPTIONS_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_OPTIONS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_configuration.h>
+#include <action_graph/global_timer/trigger.h>
+
+namespace action_graph {
+
+// Defines how a trigger catches up with the deadlines it missed, e.g. after
+// the process was suspended or the clock jumped forward.
+enum class CatchUpPolicy {
+  // Every missed deadline is fired, one per pass of the timer loop.
+  kBurst,
+  // The missed deadlines are skipped, the trigger fires once and continues
+  // with the next deadline after now.
+  kSkipToNow,
+  // Like kBurst, but at most max_catch_up_fires missed deadlines are fired,
+  // the older ones are skipped.
+  kLimitedBurst
+};
+
+struct TriggerOptions {
+  // Only used to identify the trigger in reports.
+  std::string name{};
+  OverrunPolicy overrun_policy{OverrunPolicy::kSkip};
+  // Only used by OverrunPolicy::kRunConcurrently.
+  std::size_t max_concurrent_executions{1};
+  // Offset of the deadlines within the period. The trigger fires at
+  // registration + phase + k * period for k = 1, 2, ...
+  std::chrono::nanoseconds phase{0};
+  // Triggers with an explicit phase are not moved by the staggering of the
+  // GlobalTimer.
+  bool has_phase{false};
+  // An execution should be finished this long after the deadline of its
+  // fire. Zero means one period, i.e. before the next fire. Later executions
+  // are counted as deadline misses.
+  std::chrono::nanoseconds deadline{0};
+  // The trigger may fire up to this long after its deadline, like with the
+  // timer slack of Linux, so that the timer wakes up once for all triggers
+  // whose windows overlap. The triggers with a tolerance, which are due in
+  // the same pass, are handed to the worker pool as a single task.
+  std::chrono::nanoseconds tolerance{0};
+  CatchUpPolicy catch_up_policy{CatchUpPolicy::kBurst};
+  // Only used by CatchUpPolicy::kLimitedBurst.
+  std::size_t max_catch_up_fires{1};
+  // Runs the callbacks on a thread of their own with the given
+  // configuration instead of the worker pool of the timer.
+  bool has_dedicated_thread{false};
+  executors::ThreadConfiguration dedicated_thread{};
+  // Runs the callbacks on the given executor instead of the worker pool of
+  // the timer. It has to outlive the trigger. Takes precedence over a
+  // dedicated thread.
+  executors::Executor *executor{nullptr};
+};
+
+struct NamedTriggerStatistics {
+  std::string name;
+  TriggerStatistics statistics;
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_OPTIONS_H_
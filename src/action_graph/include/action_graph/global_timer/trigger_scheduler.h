@@ -0,0 +1,389 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_SCHEDULER_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_SCHEDULER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/global_timer/global_timer_options.h>
+#include <action_graph/global_timer/latency_histogram.h>
+#include <action_graph/global_timer/timer_instrumentation.h>
+#include <action_graph/global_timer/trigger.h>
+#include <action_graph/global_timer/trigger_options.h>
+
+namespace action_graph {
+
+// A trigger registered on a timer. The deadlines are owned by the thread,
+// which drives the timer, all other members may be used by any thread.
+template <typename Clock> struct ScheduledTrigger {
+  using Duration = typename Clock::duration;
+  using TimePoint = typename Clock::time_point;
+  using Occurrence = typename Duration::rep;
+
+  ScheduledTrigger(Duration period, bool is_staggered,
+                   std::function<void()> callback, TriggerOptions options,
+                   bool has_histograms)
+      : period(std::move(period)),
+        phase(std::chrono::duration_cast<Duration>(options.phase)),
+        is_staggered(is_staggered),
+        relative_deadline(
+            std::chrono::duration_cast<Duration>(options.deadline)),
+        tolerance(std::chrono::duration_cast<Duration>(options.tolerance)),
+        catch_up_policy(options.catch_up_policy),
+        max_catch_up_fires(static_cast<Occurrence>(
+            options.catch_up_policy == CatchUpPolicy::kLimitedBurst
+                ? options.max_catch_up_fires
+                : 0)),
+        name(std::move(options.name)),
+        fire_lateness(has_histograms ? std::make_unique<LatencyHistogram>()
+                                     : nullptr),
+        run_time(has_histograms ? std::make_unique<LatencyHistogram>()
+                                : nullptr),
+        executor(options.executor),
+        dedicated_pool(options.has_dedicated_thread && executor == nullptr
+                           ? std::make_unique<executors::ThreadPool>(
+                                 1, options.dedicated_thread)
+                           : nullptr),
+        trigger(run_time ? MeasureRunTime(std::move(callback), *run_time)
+                         : std::move(callback),
+                options.overrun_policy, options.max_concurrent_executions) {}
+
+  // The deadlines are epoch + phase + k * period, so that they do not
+  // drift.
+  TimePoint Deadline() const { return epoch + phase + occurrence * period; }
+
+  // The schedule is ordered by the latest time the trigger may fire, so
+  // that the timer sleeps until the first of these and fires all triggers
+  // which are due by then in the same pass.
+  TimePoint LatestFire() const { return Deadline() + tolerance; }
+
+  // The deadline of the execution of the fire with the given deadline.
+  TimePoint DeadlineOfExecution(const TimePoint &fire_deadline) const {
+    return fire_deadline +
+           (relative_deadline > Duration::zero() ? relative_deadline : period);
+  }
+
+  // The index of the first deadline after now.
+  Occurrence OccurrenceAfter(const TimePoint &now) const {
+    const auto passed_periods = (now - (epoch + phase)) / period;
+    return std::max<Occurrence>(passed_periods + 1, 1);
+  }
+
+  // The histograms are empty, unless they are recorded.
+  TriggerInstrumentation Instrumentation() const {
+    return {name, trigger.GetStatistics(),
+            fire_lateness ? fire_lateness->Snapshot()
+                          : LatencyHistogramSnapshot{},
+            run_time ? run_time->Snapshot() : LatencyHistogramSnapshot{}};
+  }
+
+  static std::function<void()> MeasureRunTime(std::function<void()> callback,
+                                              LatencyHistogram &run_time) {
+    return [callback, &run_time]() {
+      const auto start = std::chrono::steady_clock::now();
+      callback();
+      run_time.Record(std::chrono::steady_clock::now() - start);
+    };
+  }
+
+  // owned by the thread driving the timer
+  std::size_t id{0};
+  Duration period;
+  TimePoint epoch{};
+  Duration phase;
+  Occurrence occurrence{1};
+  bool is_staggered;
+  const Duration relative_deadline;
+  const Duration tolerance;
+  const CatchUpPolicy catch_up_policy;
+  const Occurrence max_catch_up_fires;
+
+  const std::string name;
+  std::atomic<bool> is_paused{false};
+  // null, unless the timer records the histograms of its triggers,
+  // declared before the trigger, so that they outlive the executions
+  const std::unique_ptr<LatencyHistogram> fire_lateness;
+  const std::unique_ptr<LatencyHistogram> run_time;
+  executors::Executor *const executor;
+  const std::unique_ptr<executors::ThreadPool> dedicated_pool;
+  Trigger trigger;
+};
+
+// The scheduling shared by the GlobalTimer and the SimulatedTimer: the
+// deadlines of the triggers, their staggering, the catch-up policies and
+// the dispatch of the due triggers. It is not thread-safe, the timer calls
+// it from the thread which drives it.
+template <typename Clock, typename Schedule> class TriggerScheduler {
+public:
+  using Duration = typename Clock::duration;
+  using TimePoint = typename Clock::time_point;
+
+  // now reads the clock, against which the deadlines of the executions are
+  // checked. Without it, deadline misses are not counted.
+  TriggerScheduler(DispatchPolicy dispatch_policy,
+                   std::chrono::nanoseconds (*now)())
+      : dispatch_policy_(dispatch_policy), now_(now) {}
+
+  // The trigger fires for the first time one period after now.
+  void Add(std::shared_ptr<ScheduledTrigger<Clock>> scheduled_trigger,
+           const TimePoint &now) {
+    std::size_t id = triggers_.size();
+    if (free_ids_.empty()) {
+      triggers_.push_back(nullptr);
+    } else {
+      id = free_ids_.back();
+      free_ids_.pop_back();
+    }
+    scheduled_trigger->id = id;
+    scheduled_trigger->epoch = now;
+    triggers_[id] = std::move(scheduled_trigger);
+
+    auto &added_trigger = *triggers_[id];
+    max_tolerance_ = std::max(max_tolerance_, added_trigger.tolerance);
+    if (added_trigger.is_staggered) {
+      StaggerTriggersWithPeriod(added_trigger, now);
+    } else {
+      schedule_.Insert(id, added_trigger.LatestFire());
+    }
+  }
+
+  // The trigger fires one new period after now and from then on with the
+  // new period. A staggered trigger leaves its group.
+  void ChangePeriod(ScheduledTrigger<Clock> &scheduled_trigger,
+                    const Duration &period, const TimePoint &now) {
+    if (!IsScheduled(scheduled_trigger))
+      return;
+    LeaveStaggerGroup(scheduled_trigger);
+    scheduled_trigger.period = period;
+    scheduled_trigger.epoch = now;
+    scheduled_trigger.phase = Duration::zero();
+    scheduled_trigger.occurrence = 1;
+    scheduled_trigger.is_staggered = false;
+    schedule_.Update(scheduled_trigger.id, scheduled_trigger.LatestFire());
+  }
+
+  // The entry of the trigger is dropped, when it is due next.
+  void Remove(const ScheduledTrigger<Clock> &scheduled_trigger) {
+    if (!IsScheduled(scheduled_trigger))
+      return;
+    LeaveStaggerGroup(scheduled_trigger);
+    triggers_[scheduled_trigger.id] = nullptr;
+  }
+
+  bool IsEmpty() const noexcept { return schedule_.IsEmpty(); }
+
+  TimePoint EarliestDeadline() const { return schedule_.EarliestDeadline(); }
+
+  // Fires every trigger with a deadline not after now, including the ones
+  // which could still wait for their tolerance, and hands them to their
+  // executors. Without a worker pool, the callbacks run one after the other
+  // on the calling thread, which the exception of a callback is passed on
+  // to.
+  void FireDue(const TimePoint &now, executors::Executor *worker_pool) {
+    const auto horizon = now + max_tolerance_;
+    schedule_.FireDue(horizon, [this, &now](typename Schedule::Entry &entry) {
+      auto *scheduled_trigger = triggers_[entry.id].get();
+      if (scheduled_trigger == nullptr) {
+        free_ids_.push_back(entry.id);
+        return false;
+      }
+      const auto deadline = scheduled_trigger->Deadline();
+      if (deadline > now)
+        return true;
+      if (!scheduled_trigger->is_paused) {
+        if (scheduled_trigger->fire_lateness)
+          scheduled_trigger->fire_lateness->Record(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  now - deadline));
+        ready_.push_back(
+            {scheduled_trigger,
+             ExecutionDeadlineOf(*scheduled_trigger, deadline, now)});
+      }
+      scheduled_trigger->occurrence = NextOccurrence(*scheduled_trigger, now);
+      entry.deadline = scheduled_trigger->LatestFire();
+      return true;
+    });
+    if (dispatch_policy_ == DispatchPolicy::kEarliestDeadlineFirst) {
+      std::stable_sort(ready_.begin(), ready_.end(),
+                       [](const ReadyTrigger &lhs, const ReadyTrigger &rhs) {
+                         return lhs.deadline.time_since_epoch <
+                                rhs.deadline.time_since_epoch;
+                       });
+    }
+    if (worker_pool == nullptr) {
+      RunReadyTriggers();
+    } else {
+      DispatchReadyTriggers(*worker_pool);
+    }
+  }
+
+  // All triggers start over from now, e.g. after the clock jumped
+  // backwards.
+  void RestartAt(const TimePoint &now) {
+    for (auto &scheduled_trigger : triggers_) {
+      if (scheduled_trigger) {
+        scheduled_trigger->epoch = now;
+        scheduled_trigger->occurrence = 1;
+      }
+    }
+    schedule_.UpdateAll([this](typename Schedule::Entry &entry) {
+      const auto *scheduled_trigger = triggers_[entry.id].get();
+      if (scheduled_trigger != nullptr)
+        entry.deadline = scheduled_trigger->LatestFire();
+    });
+  }
+
+private:
+  using Occurrence = typename ScheduledTrigger<Clock>::Occurrence;
+
+  struct ReadyTrigger {
+    ScheduledTrigger<Clock> *scheduled_trigger;
+    ExecutionDeadline deadline;
+  };
+
+  bool IsScheduled(const ScheduledTrigger<Clock> &scheduled_trigger) const {
+    return scheduled_trigger.id < triggers_.size() &&
+           triggers_[scheduled_trigger.id].get() == &scheduled_trigger;
+  }
+
+  // All staggered triggers with the same period share the epoch of the
+  // first one and get phases evenly distributed across the period. Only the
+  // entries of the group are moved.
+  void StaggerTriggersWithPeriod(ScheduledTrigger<Clock> &new_trigger,
+                                 const TimePoint &now) {
+    const auto period = new_trigger.period;
+    auto &group = stagger_groups_[period];
+    group.push_back(&new_trigger);
+    const auto epoch = group.front()->epoch;
+    const auto group_size = static_cast<Occurrence>(group.size());
+    for (Occurrence index = 0; index < group_size; ++index) {
+      auto &member = *group[index];
+      member.epoch = epoch;
+      member.phase = period * index / group_size;
+      member.occurrence = member.OccurrenceAfter(now);
+      if (&member != &new_trigger)
+        schedule_.Update(member.id, member.LatestFire());
+    }
+    schedule_.Insert(new_trigger.id, new_trigger.LatestFire());
+  }
+
+  // The other members keep their phases.
+  void LeaveStaggerGroup(const ScheduledTrigger<Clock> &scheduled_trigger) {
+    if (!scheduled_trigger.is_staggered)
+      return;
+    const auto group = stagger_groups_.find(scheduled_trigger.period);
+    if (group == stagger_groups_.end())
+      return;
+    auto &members = group->second;
+    members.erase(
+        std::remove(members.begin(), members.end(), &scheduled_trigger),
+        members.end());
+    if (members.empty())
+      stagger_groups_.erase(group);
+  }
+
+  // Without a clock, the execution finishes in virtual time at the instant
+  // it was fired.
+  ExecutionDeadline
+  ExecutionDeadlineOf(const ScheduledTrigger<Clock> &scheduled_trigger,
+                      const TimePoint &fire_deadline,
+                      const TimePoint &now) const {
+    ExecutionDeadline deadline;
+    deadline.time_since_epoch =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            scheduled_trigger.DeadlineOfExecution(fire_deadline)
+                .time_since_epoch());
+    deadline.now = now_;
+    if (now_ == nullptr) {
+      deadline.has_virtual_finish_time = true;
+      deadline.virtual_finish_time =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              now.time_since_epoch());
+    }
+    deadline.is_earliest_deadline_first =
+        dispatch_policy_ == DispatchPolicy::kEarliestDeadlineFirst;
+    return deadline;
+  }
+
+  // The occurrence after the fired one, unless the catch-up policy skips
+  // some of the deadlines which are already due.
+  static Occurrence NextOccurrence(ScheduledTrigger<Clock> &scheduled_trigger,
+                                   const TimePoint &now) {
+    const auto next_occurrence = scheduled_trigger.occurrence + 1;
+    if (scheduled_trigger.catch_up_policy == CatchUpPolicy::kBurst)
+      return next_occurrence;
+    const auto first_future_occurrence = scheduled_trigger.OccurrenceAfter(now);
+    const auto missed_occurrences = first_future_occurrence - next_occurrence;
+    if (missed_occurrences <= scheduled_trigger.max_catch_up_fires)
+      return next_occurrence;
+    const auto skipped_occurrences =
+        missed_occurrences - scheduled_trigger.max_catch_up_fires;
+    if (!scheduled_trigger.is_paused)
+      scheduled_trigger.trigger.CountSkippedDeadlines(
+          static_cast<std::uint64_t>(skipped_occurrences));
+    return next_occurrence + skipped_occurrences;
+  }
+
+  void RunReadyTriggers() {
+    for (auto &ready : ready_) {
+      ready.scheduled_trigger->trigger.TriggerSynchronously(ready.deadline);
+    }
+    ready_.clear();
+  }
+
+  void DispatchReadyTriggers(executors::Executor &worker_pool) {
+    for (auto &ready : ready_) {
+      auto &scheduled_trigger = *ready.scheduled_trigger;
+      if (scheduled_trigger.executor != nullptr) {
+        scheduled_trigger.trigger.TriggerAsynchronously(
+            *scheduled_trigger.executor, ready.deadline);
+      } else if (scheduled_trigger.dedicated_pool) {
+        scheduled_trigger.trigger.TriggerAsynchronously(
+            *scheduled_trigger.dedicated_pool, ready.deadline);
+      } else if (scheduled_trigger.tolerance > Duration::zero()) {
+        batch_.push_back({&scheduled_trigger.trigger, ready.deadline});
+      } else {
+        scheduled_trigger.trigger.TriggerAsynchronously(worker_pool,
+                                                        ready.deadline);
+      }
+    }
+    ready_.clear();
+    if (!batch_.empty()) {
+      Trigger::TriggerAsynchronously(batch_, worker_pool);
+      batch_.clear();
+    }
+  }
+
+  const DispatchPolicy dispatch_policy_;
+  std::chrono::nanoseconds (*const now_)();
+
+  // indexed by the ids in the schedule
+  std::vector<std::shared_ptr<ScheduledTrigger<Clock>>> triggers_{};
+  std::vector<std::size_t> free_ids_{};
+  Schedule schedule_{};
+  Duration max_tolerance_{Duration::zero()};
+  // the staggered triggers by period in the order of registration
+  std::map<Duration, std::vector<ScheduledTrigger<Clock> *>>
+      stagger_groups_{};
+  std::vector<ReadyTrigger> ready_{};
+  // the triggers with a tolerance, which are dispatched as one task
+  std::vector<BatchedFire> batch_{};
+};
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_GLOBAL_TIMER_TRIGGER_SCHEDULER_H_
@@ -6,37 +6,97 @@
 #define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_PARALLEL_ACTIONS_H_
 
 #include <action_graph/action.h>
-#include <future>
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/worker_team.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 namespace action_graph {
+
+// Lets ParallelActions group children, which are too short to be worth a
+// task of their own, and run them one after the other.
+struct AdaptiveGranularity {
+  // Consecutive children are grouped until the estimated run time of the
+  // group reaches the threshold. If all children together stay below it,
+  // they run on the executing thread.
+  std::chrono::nanoseconds threshold{std::chrono::microseconds{50}};
+  // The weight of the latest run time in the moving average of a child.
+  double smoothing{0.25};
+};
+
+struct GranularityStatistics {
+  // The moving averages of the run times, zero until a child ran.
+  std::vector<std::chrono::nanoseconds> child_run_times;
+  // The number of groups of the latest execution.
+  std::size_t group_count;
+  std::uint64_t inline_executions;
+  std::uint64_t fan_out_executions;
+};
+
 class ParallelActions final : public Action {
 public:
   template <class... Actions>
   ParallelActions(std::string name, std::unique_ptr<Actions>... actions)
       : Action(std::move(name)) {
     AppendActions(std::move(actions)...);
+    AllocateExecutionState();
   }
 
   ParallelActions(std::string name,
-                  std::vector<std::unique_ptr<Action>> actions)
-      : Action(std::move(name)), sequence_(std::move(actions)) {}
+                  std::vector<std::unique_ptr<Action>> actions);
 
-  void Execute() override {
-    std::vector<std::future<void>> futures;
+  // The children are executed on the executor, which has to outlive this
+  // object, and on the executing thread. The executing thread runs every
+  // child, which no helper has started yet, so that nested parallel actions
+  // do not deadlock. Besides what the executor allocates to post a task,
+  // Execute does not allocate. If posting throws, the children, which did
+  // not start yet, are skipped and Execute passes the exception on.
+  ParallelActions(std::string name,
+                  std::vector<std::unique_ptr<Action>> actions,
+                  executors::Executor &executor);
+
+  // Binds a team of threads to this object, one for every child but the
+  // first, which runs on the executing thread. The team is released and
+  // joined through a spin barrier on every execution, which is the fastest
+  // hand-off for short children, as long as every team member has a CPU of
+  // its own. There is only one team, so that concurrent executions run one
+  // after the other.
+  ParallelActions(std::string name,
+                  std::vector<std::unique_ptr<Action>> actions,
+                  executors::WorkerTeamOptions team_options);
 
-    for (auto &action : sequence_) {
-      auto future =
-          std::async(std::launch::async, [&action]() { action->Execute(); });
-      futures.push_back(std::move(future));
-    }
+  // Waits for helpers, which were posted but found no child to run.
+  ~ParallelActions() override;
 
-    for (auto &future : futures) {
-      future.get(); // Wait for all actions to complete
-    }
-  }
+  // May be called by several threads at the same time, e.g. by a trigger
+  // with the concurrent overrun policy. Every concurrent execution gets a
+  // fork-join state of its own, which is allocated once and reused.
+  void Execute() override;
+
+  // Measures the children and groups them by their run times from now on.
+  // Children without a measurement count as long. Not used by a team. Not
+  // thread-safe with Execute.
+  void SetAdaptiveGranularity(AdaptiveGranularity granularity);
+
+  GranularityStatistics GetGranularityStatistics() const;
+
+  // At most max_concurrency children, or groups of children, run at the
+  // same time, the executing thread included. The others start as earlier
+  // ones finish. Not used by a team. Not thread-safe with Execute.
+  void SetMaxConcurrency(std::size_t max_concurrency);
+
+  // Moves the children out, e.g. to compile them into a plan, and leaves the
+  // parallel actions without children.
+  std::vector<std::unique_ptr<Action>> ReleaseActions();
 
 private:
   static void AppendActions() {}
@@ -47,7 +107,58 @@ private:
     AppendActions(std::move(remaining)...);
   }
 
+  // The state of one fork-join.
+  struct ForkJoinState {
+    explicit ForkJoinState(std::size_t child_count);
+
+    // group i ends before child group_ends[i]
+    std::vector<std::size_t> group_ends;
+    // the group count in the upper and the next unclaimed group in the
+    // lower half, so that a late helper of an earlier execution cannot
+    // combine a claim with a stale count
+    std::atomic<std::uint64_t> group_claims{0};
+    std::atomic<std::size_t> unfinished_groups{0};
+    std::atomic<std::size_t> helpers_in_flight{0};
+    std::vector<std::exception_ptr> child_exceptions;
+  };
+
+  void AllocateExecutionState();
+  ForkJoinState &AcquireState();
+  void ReleaseState(ForkJoinState &state);
+  std::size_t GroupChildren(ForkJoinState &state);
+  void RunGroup(ForkJoinState &state, std::size_t group);
+  void RunChild(std::size_t child);
+  void ClaimGroups(ForkJoinState &state, std::size_t group_count);
+  void ExecuteOnNewThreads(ForkJoinState &state, std::size_t group_count);
+  void ExecuteOnTeam();
+  void ForkJoin(ForkJoinState &state, std::size_t group_count);
+  void PostHelpers(ForkJoinState &state, std::size_t helper_count);
+  void RunHelper(ForkJoinState &state);
+  void FinishHelper(ForkJoinState &state);
+  void CancelUnclaimedGroups(ForkJoinState &state, std::size_t group_count);
+  void RunUnclaimedGroups(ForkJoinState &state);
+  void JoinGroups(ForkJoinState &state);
+  static std::exception_ptr TakeFirstException(ForkJoinState &state);
+
   std::vector<std::unique_ptr<Action>> sequence_;
+  executors::Executor *executor_{nullptr};
+  std::unique_ptr<executors::WorkerTeam> team_{};
+  std::mutex team_mutex_{};
+  std::size_t max_concurrency_{std::numeric_limits<std::size_t>::max()};
+
+  bool is_adaptive_{false};
+  AdaptiveGranularity granularity_{};
+  std::unique_ptr<std::atomic<std::int64_t>[]> run_time_averages_{};
+  std::atomic<std::size_t> latest_group_count_{0};
+  std::atomic<std::uint64_t> inline_executions_{0};
+  std::atomic<std::uint64_t> fan_out_executions_{0};
+
+  // one fork-join state per concurrent execution, allocated once
+  std::vector<std::unique_ptr<ForkJoinState>> states_{};
+  std::vector<ForkJoinState *> free_states_{};
+  std::mutex states_mutex_{};
+  std::mutex join_mutex_{};
+  std::condition_variable joined_{};
 };
 } // namespace action_graph
 
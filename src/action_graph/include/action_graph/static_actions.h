@@ -0,0 +1,340 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_STATIC_ACTIONS_H_
+#define SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_STATIC_ACTIONS_H_
+
+#include <action_graph/action.h>
+#include <action_graph/executors/executor.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Graphs, whose structure is known at compile time, composed from types
+// instead of objects. A static action is any type with a non-virtual
+// Execute(). The composites hold their children by value and call them
+// directly, so that the compiler can inline the whole graph. At the
+// boundary to the dynamic graph, WrapStaticAction turns one into an Action.
+namespace action_graph {
+
+template <class Function> class StaticAction {
+public:
+  explicit StaticAction(Function function) : function_(std::move(function)) {}
+
+  void Execute() { function_(); }
+
+private:
+  Function function_;
+};
+
+template <class... Children> class StaticSequence {
+public:
+  explicit StaticSequence(Children... children)
+      : children_(std::move(children)...) {}
+
+  void Execute() { ExecuteInOrder(std::index_sequence_for<Children...>{}); }
+
+  std::tuple<Children...> &GetChildren() noexcept { return children_; }
+
+private:
+  template <std::size_t... Indices>
+  void ExecuteInOrder(std::index_sequence<Indices...>) {
+    // the elements of a braced list are evaluated from left to right
+    const int in_order[] = {0, (std::get<Indices>(children_).Execute(), 0)...};
+    static_cast<void>(in_order);
+  }
+
+  std::tuple<Children...> children_;
+};
+
+// The children run on the executor, which has to outlive this object, and on
+// the executing thread, which runs every child no helper has started yet.
+// Without an executor, the helpers run on new threads. Like
+// ParallelActions, Execute does not allocate besides what the executor
+// allocates to post a helper, and several threads may execute the same
+// object at the same time. If posting throws, the children, which did not
+// start yet, are skipped and Execute passes the exception on.
+template <class... Children> class StaticParallel {
+public:
+  explicit StaticParallel(Children... children)
+      : StaticParallel(DefaultExecutor(), std::move(children)...) {}
+
+  explicit StaticParallel(executors::Executor &executor, Children... children)
+      : executor_(&executor), children_(std::move(children)...) {
+    states_.push_back(std::make_unique<ExecutionState>());
+    free_states_.push_back(states_.back().get());
+  }
+
+  // Helpers keep a pointer to this object, so that it may only be moved
+  // before its first execution, e.g. out of MakeStaticParallel.
+  StaticParallel(StaticParallel &&other)
+      : executor_(other.executor_), children_(std::move(other.children_)),
+        states_(std::move(other.states_)),
+        free_states_(std::move(other.free_states_)) {}
+
+  StaticParallel(const StaticParallel &) = delete;
+  StaticParallel &operator=(const StaticParallel &) = delete;
+  StaticParallel &operator=(StaticParallel &&) = delete;
+
+  // Waits for helpers, which were posted but found no child to run.
+  ~StaticParallel() {
+    std::unique_lock<std::mutex> lock(join_mutex_);
+    joined_.wait(lock, [this]() {
+      return std::all_of(states_.begin(), states_.end(),
+                         [](const std::unique_ptr<ExecutionState> &state) {
+                           return state->helpers_in_flight.load() == 0;
+                         });
+    });
+  }
+
+  void Execute() {
+    if (kChildCount == 0) {
+      return;
+    }
+    auto &state = AcquireState();
+    // in this order, so that a helper of the previous execution, which claims
+    // a child as soon as next_child is reset, counts down the new count
+    state.unfinished_children = kChildCount;
+    state.next_child = 0;
+    // helpers, which are still queued, take part in this execution
+    const auto wanted_helpers = kChildCount - 1;
+    const auto helper_count =
+        wanted_helpers -
+        std::min(wanted_helpers, state.helpers_in_flight.load());
+    try {
+      PostHelpers(state, helper_count);
+    } catch (...) {
+      // the helpers, which were posted, may still run claimed children
+      CancelUnclaimedChildren(state);
+      Join(state);
+      TakeFirstException(state);
+      ReleaseState(state);
+      throw;
+    }
+    RunUnclaimedChildren(state);
+    Join(state);
+    const auto exception = TakeFirstException(state);
+    ReleaseState(state);
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  std::tuple<Children...> &GetChildren() noexcept { return children_; }
+
+private:
+  static constexpr std::size_t kChildCount = sizeof...(Children);
+
+  // The state of one execution.
+  struct ExecutionState {
+    std::atomic<std::size_t> next_child{0};
+    std::atomic<std::size_t> unfinished_children{0};
+    std::atomic<std::size_t> helpers_in_flight{0};
+    std::array<std::exception_ptr, kChildCount> child_exceptions{};
+  };
+
+  static executors::Executor &DefaultExecutor() {
+    static executors::ThreadPerTaskExecutor executor;
+    return executor;
+  }
+
+  // Reuses a free state or, while all states are in use by concurrent
+  // executions, adds another one.
+  ExecutionState &AcquireState() {
+    std::lock_guard<std::mutex> lock(states_mutex_);
+    if (free_states_.empty()) {
+      states_.push_back(std::make_unique<ExecutionState>());
+      // so that releasing a state never allocates
+      free_states_.reserve(states_.size());
+      return *states_.back();
+    }
+    auto &state = *free_states_.back();
+    free_states_.pop_back();
+    return state;
+  }
+
+  void ReleaseState(ExecutionState &state) {
+    std::lock_guard<std::mutex> lock(states_mutex_);
+    free_states_.push_back(&state);
+  }
+
+  void PostHelpers(ExecutionState &state, std::size_t helper_count) {
+    for (std::size_t helper = 0; helper < helper_count; ++helper) {
+      // counted before, so that the helper cannot count down first
+      ++state.helpers_in_flight;
+      try {
+        // small enough to be stored inside the std::function
+        executor_->Post([this, &state]() { RunHelper(state); });
+      } catch (...) {
+        FinishHelper(state);
+        throw;
+      }
+    }
+  }
+
+  void RunHelper(ExecutionState &state) {
+    RunUnclaimedChildren(state);
+    FinishHelper(state);
+  }
+
+  void FinishHelper(ExecutionState &state) {
+    // under the lock, so that the destructor cannot finish before
+    std::lock_guard<std::mutex> lock(join_mutex_);
+    if (--state.helpers_in_flight == 0) {
+      joined_.notify_all();
+    }
+  }
+
+  // Lets no thread start another child of this execution and counts the
+  // children, which no thread claimed, as finished.
+  void CancelUnclaimedChildren(ExecutionState &state) {
+    const std::size_t child_count = kChildCount;
+    const auto next_child =
+        std::min(state.next_child.exchange(child_count), child_count);
+    const auto cancelled_children = child_count - next_child;
+    if (cancelled_children > 0 &&
+        (state.unfinished_children -= cancelled_children) == 0) {
+      std::lock_guard<std::mutex> lock(join_mutex_);
+      joined_.notify_all();
+    }
+  }
+
+  // A helper, which starts after its Execute returned, takes part in the
+  // next one with the same state or finds no child to run.
+  void RunUnclaimedChildren(ExecutionState &state) {
+    for (auto child = state.next_child++; child < kChildCount;
+         child = state.next_child++) {
+      try {
+        RunChild(child, std::integral_constant<std::size_t, 0>{});
+      } catch (...) {
+        state.child_exceptions[child] = std::current_exception();
+      }
+      if (--state.unfinished_children == 0) {
+        std::lock_guard<std::mutex> lock(join_mutex_);
+        joined_.notify_all();
+      }
+    }
+  }
+
+  // compiles into a switch over the inlined children
+  template <std::size_t Index>
+  void RunChild(std::size_t child, std::integral_constant<std::size_t, Index>) {
+    if (child == Index) {
+      std::get<Index>(children_).Execute();
+      return;
+    }
+    RunChild(child, std::integral_constant<std::size_t, Index + 1>{});
+  }
+
+  void RunChild(std::size_t,
+                std::integral_constant<std::size_t, kChildCount>) {}
+
+  void Join(ExecutionState &state) {
+    const auto is_joined = [&state]() {
+      return state.unfinished_children.load() == 0;
+    };
+    for (int round = 0; round < kJoinSpinRounds; ++round) {
+      if (is_joined()) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(join_mutex_);
+    joined_.wait(lock, is_joined);
+  }
+
+  static std::exception_ptr TakeFirstException(ExecutionState &state) {
+    auto &exceptions = state.child_exceptions;
+    const auto first = std::find_if(exceptions.begin(), exceptions.end(),
+                                    [](const std::exception_ptr &exception) {
+                                      return static_cast<bool>(exception);
+                                    });
+    if (first == exceptions.end()) {
+      return nullptr;
+    }
+    auto exception = *first;
+    std::fill(exceptions.begin(), exceptions.end(), nullptr);
+    return exception;
+  }
+
+  // rounds of polling before the executing thread sleeps until the last
+  // child is finished
+  static constexpr int kJoinSpinRounds = 64;
+
+  executors::Executor *executor_;
+  std::tuple<Children...> children_;
+  // one state per concurrent execution, allocated once
+  std::vector<std::unique_ptr<ExecutionState>> states_{};
+  std::vector<ExecutionState *> free_states_{};
+  std::mutex states_mutex_{};
+  std::mutex join_mutex_{};
+  std::condition_variable joined_{};
+};
+
+// Lets a static graph take part in a dynamic one, e.g. on the GlobalTimer or
+// as a child of an ActionSequence built from a configuration.
+template <class Static> class WrappedStaticAction final : public Action {
+public:
+  WrappedStaticAction(std::string name, Static static_action)
+      : Action(std::move(name)), static_action_(std::move(static_action)) {}
+
+  void Execute() override { static_action_.Execute(); }
+
+  Static &GetStaticAction() noexcept { return static_action_; }
+
+private:
+  Static static_action_;
+};
+
+// C++14 cannot deduce the template arguments of a constructor, so that the
+// static actions are created by these functions.
+template <class Function>
+StaticAction<std::decay_t<Function>> MakeStaticAction(Function &&function) {
+  return StaticAction<std::decay_t<Function>>(
+      std::forward<Function>(function));
+}
+
+template <class... Children>
+StaticSequence<std::decay_t<Children>...>
+MakeStaticSequence(Children &&...children) {
+  return StaticSequence<std::decay_t<Children>...>(
+      std::forward<Children>(children)...);
+}
+
+template <class... Children>
+StaticParallel<std::decay_t<Children>...>
+MakeStaticParallel(Children &&...children) {
+  return StaticParallel<std::decay_t<Children>...>(
+      std::forward<Children>(children)...);
+}
+
+// Named differently, so that an executor is not taken for a child.
+template <class... Children>
+StaticParallel<std::decay_t<Children>...>
+MakeStaticParallelOn(executors::Executor &executor, Children &&...children) {
+  return StaticParallel<std::decay_t<Children>...>(
+      executor, std::forward<Children>(children)...);
+}
+
+template <class Static>
+std::unique_ptr<Action> WrapStaticAction(std::string name,
+                                         Static &&static_action) {
+  return std::make_unique<WrappedStaticAction<std::decay_t<Static>>>(
+      std::move(name), std::forward<Static>(static_action));
+}
+
+} // namespace action_graph
+
+#endif // SRC_ACTION_GRAPH_INCLUDE_ACTION_GRAPH_STATIC_ACTIONS_H_
@@ -0,0 +1,376 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/parallel_actions.h>
+
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+namespace action_graph {
+
+namespace {
+
+// Rounds of polling before the executing thread sleeps until the last group
+// is finished.
+constexpr int kJoinSpinRounds = 64;
+
+// selects the next unclaimed group from ForkJoinState::group_claims
+constexpr std::uint64_t kGroupMask = 0xffffffff;
+
+} // namespace
+
+ParallelActions::ParallelActions(std::string name,
+                                 std::vector<std::unique_ptr<Action>> actions)
+    : Action(std::move(name)), sequence_(std::move(actions)) {
+  AllocateExecutionState();
+}
+
+ParallelActions::ParallelActions(std::string name,
+                                 std::vector<std::unique_ptr<Action>> actions,
+                                 executors::Executor &executor)
+    : Action(std::move(name)), sequence_(std::move(actions)),
+      executor_(&executor) {
+  AllocateExecutionState();
+}
+
+ParallelActions::ParallelActions(std::string name,
+                                 std::vector<std::unique_ptr<Action>> actions,
+                                 executors::WorkerTeamOptions team_options)
+    : Action(std::move(name)), sequence_(std::move(actions)),
+      team_(std::make_unique<executors::WorkerTeam>(
+          sequence_.empty() ? 0 : sequence_.size() - 1,
+          [this](std::size_t member) { sequence_[member + 1]->Execute(); },
+          std::move(team_options))) {
+  AllocateExecutionState();
+}
+
+ParallelActions::~ParallelActions() {
+  std::unique_lock<std::mutex> lock(join_mutex_);
+  joined_.wait(lock, [this]() {
+    return std::all_of(states_.begin(), states_.end(),
+                       [](const std::unique_ptr<ForkJoinState> &state) {
+                         return state->helpers_in_flight.load() == 0;
+                       });
+  });
+}
+
+ParallelActions::ForkJoinState::ForkJoinState(std::size_t child_count)
+    : group_ends(child_count), child_exceptions(child_count) {
+  for (std::size_t child = 0; child < child_count; ++child) {
+    group_ends[child] = child + 1;
+  }
+}
+
+void ParallelActions::Execute() {
+  if (sequence_.empty()) {
+    return;
+  }
+  if (team_) {
+    ++fan_out_executions_;
+    ExecuteOnTeam();
+    return;
+  }
+  auto &state = AcquireState();
+  std::exception_ptr exception;
+  try {
+    const auto group_count = GroupChildren(state);
+    latest_group_count_ = group_count;
+    if (group_count == 1 && is_adaptive_) {
+      ++inline_executions_;
+      RunGroup(state, 0);
+    } else if (executor_ != nullptr) {
+      ++fan_out_executions_;
+      ForkJoin(state, group_count);
+    } else {
+      ++fan_out_executions_;
+      ExecuteOnNewThreads(state, group_count);
+    }
+    exception = TakeFirstException(state);
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  ReleaseState(state);
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ParallelActions::SetAdaptiveGranularity(AdaptiveGranularity granularity) {
+  if (granularity.smoothing <= 0.0 || granularity.smoothing > 1.0) {
+    throw std::invalid_argument(
+        "The smoothing of the adaptive granularity has to be in (0, 1].");
+  }
+  granularity_ = granularity;
+  is_adaptive_ = true;
+}
+
+void ParallelActions::SetMaxConcurrency(std::size_t max_concurrency) {
+  if (max_concurrency == 0) {
+    throw std::invalid_argument(
+        "ParallelActions needs a concurrency of at least one.");
+  }
+  max_concurrency_ = max_concurrency;
+}
+
+std::vector<std::unique_ptr<Action>> ParallelActions::ReleaseActions() {
+  auto actions = std::move(sequence_);
+  sequence_.clear();
+  return actions;
+}
+
+GranularityStatistics ParallelActions::GetGranularityStatistics() const {
+  GranularityStatistics statistics{};
+  statistics.child_run_times.reserve(sequence_.size());
+  for (std::size_t child = 0; child < sequence_.size(); ++child) {
+    statistics.child_run_times.emplace_back(
+        run_time_averages_[child].load(std::memory_order_relaxed));
+  }
+  statistics.group_count = latest_group_count_.load();
+  statistics.inline_executions = inline_executions_.load();
+  statistics.fan_out_executions = fan_out_executions_.load();
+  return statistics;
+}
+
+void ParallelActions::AllocateExecutionState() {
+  const auto child_count = sequence_.size();
+  run_time_averages_ =
+      std::make_unique<std::atomic<std::int64_t>[]>(child_count);
+  states_.push_back(std::make_unique<ForkJoinState>(child_count));
+  free_states_.push_back(states_.back().get());
+}
+
+// Reuses a free state or, while all states are in use by concurrent
+// executions, adds another one.
+ParallelActions::ForkJoinState &ParallelActions::AcquireState() {
+  std::lock_guard<std::mutex> lock(states_mutex_);
+  if (free_states_.empty()) {
+    states_.push_back(std::make_unique<ForkJoinState>(sequence_.size()));
+    // so that releasing a state never allocates
+    free_states_.reserve(states_.size());
+    return *states_.back();
+  }
+  auto &state = *free_states_.back();
+  free_states_.pop_back();
+  return state;
+}
+
+void ParallelActions::ReleaseState(ForkJoinState &state) {
+  std::lock_guard<std::mutex> lock(states_mutex_);
+  free_states_.push_back(&state);
+}
+
+// Without adaptive granularity, every child is a group of its own.
+std::size_t ParallelActions::GroupChildren(ForkJoinState &state) {
+  const auto child_count = sequence_.size();
+  if (!is_adaptive_) {
+    return child_count;
+  }
+  auto &group_ends = state.group_ends;
+  const auto threshold = granularity_.threshold.count();
+  std::size_t group_count = 0;
+  std::int64_t group_run_time = 0;
+  for (std::size_t child = 0; child < child_count; ++child) {
+    const auto run_time =
+        run_time_averages_[child].load(std::memory_order_relaxed);
+    group_run_time += run_time > 0 ? run_time : threshold;
+    if (group_run_time >= threshold) {
+      group_ends[group_count++] = child + 1;
+      group_run_time = 0;
+    }
+  }
+  if (group_count == 0) {
+    group_ends[group_count++] = child_count;
+  } else {
+    // the short rest joins the last group
+    group_ends[group_count - 1] = child_count;
+  }
+  return group_count;
+}
+
+void ParallelActions::RunGroup(ForkJoinState &state, std::size_t group) {
+  const auto begin = group == 0 ? 0 : state.group_ends[group - 1];
+  for (auto child = begin; child < state.group_ends[group]; ++child) {
+    try {
+      RunChild(child);
+    } catch (...) {
+      state.child_exceptions[child] = std::current_exception();
+    }
+  }
+}
+
+void ParallelActions::RunChild(std::size_t child) {
+  if (!is_adaptive_) {
+    sequence_[child]->Execute();
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  sequence_[child]->Execute();
+  const auto run_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+  auto &average = run_time_averages_[child];
+  const auto previous = average.load(std::memory_order_relaxed);
+  const auto updated =
+      previous == 0
+          ? run_time
+          : previous + static_cast<std::int64_t>(granularity_.smoothing *
+                                                 (run_time - previous));
+  // zero is reserved for children, which never ran
+  average.store(std::max<std::int64_t>(updated, 1), std::memory_order_relaxed);
+}
+
+void ParallelActions::ClaimGroups(ForkJoinState &state,
+                                  std::size_t group_count) {
+  state.unfinished_groups = group_count;
+  state.group_claims = static_cast<std::uint64_t>(group_count) << 32;
+}
+
+// Every thread runs groups until none is left.
+void ParallelActions::ExecuteOnNewThreads(ForkJoinState &state,
+                                          std::size_t group_count) {
+  ClaimGroups(state, group_count);
+  const auto thread_count = std::min(group_count, max_concurrency_);
+  std::vector<std::future<void>> futures;
+
+  for (std::size_t thread = 0; thread < thread_count; ++thread) {
+    auto future = std::async(std::launch::async,
+                             [this, &state]() { RunUnclaimedGroups(state); });
+    futures.push_back(std::move(future));
+  }
+
+  for (auto &future : futures) {
+    future.get(); // Wait for all actions to complete
+  }
+}
+
+// The team serves one execution at a time.
+void ParallelActions::ExecuteOnTeam() {
+  std::lock_guard<std::mutex> lock(team_mutex_);
+  team_->Release();
+  std::exception_ptr exception;
+  try {
+    sequence_.front()->Execute();
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  team_->Join();
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ParallelActions::ForkJoin(ForkJoinState &state, std::size_t group_count) {
+  ClaimGroups(state, group_count);
+  // Helpers, which are still queued from earlier executions, take part in
+  // this one, so that the executing thread and the helpers stay within the
+  // concurrency limit.
+  const auto wanted_helpers = std::min(group_count, max_concurrency_) - 1;
+  const auto helper_count =
+      wanted_helpers - std::min(wanted_helpers, state.helpers_in_flight.load());
+  try {
+    PostHelpers(state, helper_count);
+  } catch (...) {
+    // the helpers, which were posted, may still run claimed groups
+    CancelUnclaimedGroups(state, group_count);
+    JoinGroups(state);
+    throw;
+  }
+  RunUnclaimedGroups(state);
+  JoinGroups(state);
+}
+
+void ParallelActions::PostHelpers(ForkJoinState &state,
+                                  std::size_t helper_count) {
+  for (std::size_t helper = 0; helper < helper_count; ++helper) {
+    // counted before, so that the helper cannot count down first
+    ++state.helpers_in_flight;
+    try {
+      // small enough to be stored inside the std::function
+      executor_->Post([this, &state]() { RunHelper(state); });
+    } catch (...) {
+      FinishHelper(state);
+      throw;
+    }
+  }
+}
+
+void ParallelActions::RunHelper(ForkJoinState &state) {
+  RunUnclaimedGroups(state);
+  FinishHelper(state);
+}
+
+void ParallelActions::FinishHelper(ForkJoinState &state) {
+  // under the lock, so that the destructor cannot finish before
+  std::lock_guard<std::mutex> lock(join_mutex_);
+  if (--state.helpers_in_flight == 0) {
+    joined_.notify_all();
+  }
+}
+
+// Lets no thread start another group of this execution and counts the
+// groups, which no thread claimed, as finished.
+void ParallelActions::CancelUnclaimedGroups(ForkJoinState &state,
+                                            std::size_t group_count) {
+  const auto claim = state.group_claims.exchange(
+      (static_cast<std::uint64_t>(group_count) << 32) | group_count);
+  const auto next_group =
+      std::min(static_cast<std::size_t>(claim & kGroupMask), group_count);
+  const auto cancelled_groups = group_count - next_group;
+  if (cancelled_groups > 0 &&
+      (state.unfinished_groups -= cancelled_groups) == 0) {
+    std::lock_guard<std::mutex> lock(join_mutex_);
+    joined_.notify_all();
+  }
+}
+
+// A helper, which starts after its Execute returned, takes part in the next
+// execution with the same state or finds no group to run.
+void ParallelActions::RunUnclaimedGroups(ForkJoinState &state) {
+  while (true) {
+    const auto claim = state.group_claims++;
+    const auto group = static_cast<std::size_t>(claim & kGroupMask);
+    if (group >= static_cast<std::size_t>(claim >> 32)) {
+      return;
+    }
+    RunGroup(state, group);
+    if (--state.unfinished_groups == 0) {
+      std::lock_guard<std::mutex> lock(join_mutex_);
+      joined_.notify_all();
+    }
+  }
+}
+
+void ParallelActions::JoinGroups(ForkJoinState &state) {
+  const auto is_joined = [&state]() {
+    return state.unfinished_groups.load() == 0;
+  };
+  for (int round = 0; round < kJoinSpinRounds; ++round) {
+    if (is_joined()) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(join_mutex_);
+  joined_.wait(lock, is_joined);
+}
+
+std::exception_ptr
+ParallelActions::TakeFirstException(ForkJoinState &state) {
+  auto &exceptions = state.child_exceptions;
+  const auto first = std::find_if(exceptions.begin(), exceptions.end(),
+                                  [](const std::exception_ptr &exception) {
+                                    return static_cast<bool>(exception);
+                                  });
+  if (first == exceptions.end()) {
+    return nullptr;
+  }
+  auto exception = *first;
+  std::fill(exceptions.begin(), exceptions.end(), nullptr);
+  return exception;
+}
+
+} // namespace action_graph
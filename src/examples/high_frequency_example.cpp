@@ -49,7 +49,10 @@ void RunHighFrequencyTriggerExample(ConsoleLog &log) {
 
   auto configuration = Node::CreateFromString(kYaml);
   auto builder = CreateLoggingActionBuilder(log);
-  auto timer = std::make_unique<GlobalTimer<TimerClock>>();
+  // spread the three sensors across the period instead of firing them at once
+  action_graph::GlobalTimerOptions timer_options;
+  timer_options.stagger_triggers = true;
+  auto timer = std::make_unique<GlobalTimer<TimerClock>>(timer_options);
   const auto actions = BuildActionGraph(configuration, builder, *timer);
   log.LogMessage("Registered " + std::to_string(actions.size()) +
                  " high-frequency actions.");
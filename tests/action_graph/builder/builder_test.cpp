@@ -5,13 +5,19 @@
 
 #include <action_graph/builder/builder.h>
 #include <action_graph/builder/generic_action_builder.h>
+#include <action_graph/executors/executor.h>
 #include <gtest/gtest.h>
 #include <native_configuration/map_node.h>
 #include <native_configuration/scalar_node.h>
 #include <native_configuration/sequence_node.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <utility>
 
 #include <action_graph/global_timer/global_timer.h>
+#include <action_graph/global_timer/sharded_timer.h>
 #include <builder/callback_action.h>
 #include <test_clock.h>
 
@@ -111,3 +117,193 @@ TEST_F(BuildTriggerTest, BuildTrigger_single_trigger) {
   AdvanceTime(std::chrono::seconds{1});
   EXPECT_EQ(message, "one second executed");
 }
+
+TEST_F(BuildTriggerTest, BuildActionGraph_sharded_timer) {
+  using action_graph::builder::BuildActionGraph;
+  action_graph::ShardedTimer<TestClock> sharded_timer{};
+
+  auto action = BuildActionGraph(kSimpleGraph, action_builder, sharded_timer);
+  EXPECT_EQ(sharded_timer.GetTriggerStatistics().size(), 2);
+
+  TestClock::advance_time(std::chrono::seconds{2});
+  sharded_timer.WaitOneCycle();
+  EXPECT_EQ(message, "two seconds executed");
+}
+
+TEST(ParseTriggerOptions, defaults) {
+  const MapNode trigger{std::make_pair("name", ScalarNode{"trigger"}),
+                        std::make_pair("period", ScalarNode{"1 seconds"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_EQ(options.name, "trigger");
+  EXPECT_EQ(options.overrun_policy, action_graph::OverrunPolicy::kSkip);
+  EXPECT_EQ(options.max_concurrent_executions, 1);
+  EXPECT_FALSE(options.has_phase);
+  EXPECT_EQ(options.catch_up_policy, action_graph::CatchUpPolicy::kBurst);
+}
+
+TEST(ParseTriggerOptions, overrun_policy) {
+  const MapNode trigger{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("overrun_policy", ScalarNode{"concurrent"}),
+      std::make_pair("max_concurrent_executions", ScalarNode{"3"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_EQ(options.overrun_policy,
+            action_graph::OverrunPolicy::kRunConcurrently);
+  EXPECT_EQ(options.max_concurrent_executions, 3);
+}
+
+TEST(ParseTriggerOptions, phase) {
+  const MapNode trigger{std::make_pair("name", ScalarNode{"trigger"}),
+                        std::make_pair("phase", ScalarNode{"5 milliseconds"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_TRUE(options.has_phase);
+  EXPECT_EQ(options.phase, std::chrono::milliseconds{5});
+}
+
+TEST(ParseTriggerOptions, deadline) {
+  const MapNode trigger{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("deadline", ScalarNode{"2 milliseconds"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_EQ(options.deadline, std::chrono::milliseconds{2});
+}
+
+TEST(ParseTriggerOptions, tolerance) {
+  const MapNode trigger{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("tolerance", ScalarNode{"3 milliseconds"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_EQ(options.tolerance, std::chrono::milliseconds{3});
+}
+
+TEST(ParseTriggerOptions, catch_up_policy) {
+  const MapNode trigger{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("catch_up_policy", ScalarNode{"limited_burst"}),
+      std::make_pair("max_catch_up_fires", ScalarNode{"4"})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  EXPECT_EQ(options.catch_up_policy,
+            action_graph::CatchUpPolicy::kLimitedBurst);
+  EXPECT_EQ(options.max_catch_up_fires, 4);
+}
+
+TEST(ParseTriggerOptions, dedicated_thread) {
+  const MapNode trigger{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair(
+          "thread",
+          MapNode{std::make_pair("name", ScalarNode{"sensor"}),
+                  std::make_pair("cpu_affinity",
+                                 SequenceNode{ScalarNode{"2"}, ScalarNode{"3"}}),
+                  std::make_pair("scheduling_policy", ScalarNode{"fifo"}),
+                  std::make_pair("priority", ScalarNode{"80"}),
+                  std::make_pair("stack_size", ScalarNode{"262144"})})};
+  const auto options = action_graph::builder::ParseTriggerOptions(trigger);
+  ASSERT_TRUE(options.has_dedicated_thread);
+  const auto &thread = options.dedicated_thread;
+  EXPECT_EQ(thread.name, "sensor");
+  EXPECT_EQ(thread.cpu_affinity, (std::vector<std::size_t>{2, 3}));
+  EXPECT_EQ(thread.scheduling_policy,
+            action_graph::executors::SchedulingPolicy::kFifo);
+  EXPECT_EQ(thread.priority, 80);
+  EXPECT_EQ(thread.stack_size, 262144);
+}
+
+TEST(ParseTriggerOptions, invalid_values) {
+  using action_graph::builder::ConfigurationError;
+  using action_graph::builder::ParseTriggerOptions;
+  const MapNode unknown_policy{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("overrun_policy", ScalarNode{"sometimes"})};
+  EXPECT_THROW(ParseTriggerOptions(unknown_policy), ConfigurationError);
+
+  const MapNode no_executions{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("max_concurrent_executions", ScalarNode{"0"})};
+  EXPECT_THROW(ParseTriggerOptions(no_executions), ConfigurationError);
+
+  const MapNode unknown_catch_up{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("catch_up_policy", ScalarNode{"never"})};
+  EXPECT_THROW(ParseTriggerOptions(unknown_catch_up), ConfigurationError);
+
+  const MapNode unknown_scheduling{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("thread", MapNode{std::make_pair("scheduling_policy",
+                                                      ScalarNode{"eager"})})};
+  EXPECT_THROW(ParseTriggerOptions(unknown_scheduling), ConfigurationError);
+}
+
+TEST(ParseTriggerOptions, numbers_out_of_range) {
+  using action_graph::builder::ConfigurationError;
+  using action_graph::builder::ParseTriggerOptions;
+  const MapNode too_many_fires{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("max_catch_up_fires",
+                     ScalarNode{"123456789012345678901234567890"})};
+  try {
+    ParseTriggerOptions(too_many_fires);
+    FAIL() << "Expected a ConfigurationError.";
+  } catch (const ConfigurationError &error) {
+    EXPECT_NE(std::string(error.what()).find("max_catch_up_fires"),
+              std::string::npos);
+  }
+
+  const MapNode too_high_priority{
+      std::make_pair("name", ScalarNode{"trigger"}),
+      std::make_pair("thread", MapNode{std::make_pair(
+                                   "priority", ScalarNode{"4294967296"})})};
+  EXPECT_THROW(ParseTriggerOptions(too_high_priority), ConfigurationError);
+}
+
+// Runs the tasks inline and counts them.
+class CountingExecutor final : public action_graph::executors::Executor {
+public:
+  void Post(std::function<void()> task) override {
+    ++posts;
+    task();
+  }
+  void Post(std::function<void()> task, std::chrono::nanoseconds) override {
+    Post(std::move(task));
+  }
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override {
+    for (std::size_t index = 0; index < count; ++index)
+      task(index);
+  }
+
+  std::atomic<int> posts{0};
+};
+
+TEST_F(BuildTriggerTest, BuildActionGraph_executor) {
+  using action_graph::builder::BuildActionGraph;
+  CountingExecutor executor;
+
+  auto action = BuildActionGraph(kSimpleGraph, action_builder, timer, executor);
+
+  AdvanceTime(std::chrono::seconds{2});
+  EXPECT_EQ(message, "two seconds executed");
+  EXPECT_EQ(executor.posts.load(), 1);
+}
+
+TEST_F(BuildTriggerTest, BuildActionGraph_executor_keeps_dedicated_thread) {
+  using action_graph::builder::BuildActionGraph;
+  MapNode action_node{
+      std::make_pair("name", ScalarNode{"action"}),
+      std::make_pair("type", ScalarNode{"callback_action"}),
+      std::make_pair("message", ScalarNode{"dedicated executed"})};
+  const SequenceNode graph{MapNode{std::make_pair(
+      "trigger",
+      MapNode{std::make_pair("name", ScalarNode{"dedicated"}),
+              std::make_pair("period", ScalarNode{"2 seconds"}),
+              std::make_pair("thread", MapNode{std::make_pair(
+                                           "name", ScalarNode{"dedicated"})}),
+              std::make_pair("action", std::move(action_node))})}};
+  CountingExecutor executor;
+
+  auto action = BuildActionGraph(graph, action_builder, timer, executor);
+
+  AdvanceTime(std::chrono::seconds{2});
+  EXPECT_EQ(message, "dedicated executed");
+  EXPECT_EQ(executor.posts.load(), 0);
+}
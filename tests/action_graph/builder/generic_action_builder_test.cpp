@@ -6,7 +6,9 @@
 #include <action_graph/builder/generic_action_builder.h>
 #include <action_graph/builder/generic_action_decorator.h>
 #include <action_graph/decorators/decorated_action.h>
+#include <action_graph/parallel_actions.h>
 #include <algorithm>
+#include <atomic>
 #include <gtest/gtest.h>
 #include <native_configuration/map_node.h>
 #include <native_configuration/scalar_node.h>
@@ -207,3 +209,218 @@ TEST(GenericActionBuilder, decorated_action) {
 
   EXPECT_EQ(output.str(), "second(first(decorated action))");
 }
+
+TEST(GenericActionBuilder, parallel_actions_on_executor) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  action_graph::executors::InlineExecutor executor;
+  std::vector<std::string> messages;
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions(executor);
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [&messages](const ConfigurationNode &node, const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(
+            node,
+            [&messages](const std::string &msg) { messages.push_back(msg); });
+      });
+
+  auto action = action_builder(kParallelActions);
+
+  action->Execute();
+
+  EXPECT_EQ(messages, (std::vector<std::string>{"action1 executed",
+                                                "action2 executed"}));
+}
+
+MapNode CreateCallbackActionNode(const std::string &name) {
+  return MapNode{std::make_pair(
+      "action",
+      MapNode{std::make_pair("name", ScalarNode{name}),
+              std::make_pair("type", ScalarNode{"callback_action"}),
+              std::make_pair("message", ScalarNode{name + " executed"})})};
+}
+
+MapNode CreateParallelActionsWithMode(const std::string &mode) {
+  return MapNode{std::make_pair(
+      "action",
+      MapNode{std::make_pair("name", ScalarNode{"action"}),
+              std::make_pair("type", ScalarNode{"parallel_actions"}),
+              std::make_pair("mode", ScalarNode{mode}),
+              std::make_pair("spin", ScalarNode{"10 microseconds"}),
+              std::make_pair(
+                  "actions",
+                  SequenceNode{CreateCallbackActionNode("action1"),
+                               CreateCallbackActionNode("action2")})})};
+}
+
+TEST(GenericActionBuilder, parallel_actions_on_team) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  std::mutex messages_mutex;
+  std::vector<std::string> messages;
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions();
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [&messages, &messages_mutex](const ConfigurationNode &node,
+                                   const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(
+            node, [&messages, &messages_mutex](const std::string &msg) {
+              std::lock_guard<std::mutex> guard(messages_mutex);
+              messages.push_back(msg);
+            });
+      });
+
+  auto action = action_builder(CreateParallelActionsWithMode("team"));
+  action->Execute();
+
+  std::sort(messages.begin(), messages.end());
+  EXPECT_EQ(messages, (std::vector<std::string>{"action1 executed",
+                                                "action2 executed"}));
+  EXPECT_THROW(action_builder(CreateParallelActionsWithMode("unknown")),
+               action_graph::builder::ConfigurationError);
+}
+
+TEST(GenericActionBuilder, parallel_actions_with_adaptive_threshold) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions();
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [](const ConfigurationNode &node, const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(node, [](const std::string &) {});
+      });
+  const MapNode configuration{std::make_pair(
+      "action",
+      MapNode{std::make_pair("name", ScalarNode{"action"}),
+              std::make_pair("type", ScalarNode{"parallel_actions"}),
+              std::make_pair("adaptive_threshold", ScalarNode{"1 seconds"}),
+              std::make_pair(
+                  "actions",
+                  SequenceNode{CreateCallbackActionNode("action1"),
+                               CreateCallbackActionNode("action2")})})};
+
+  auto action = action_builder(configuration);
+  action->Execute();
+  action->Execute();
+
+  auto &parallel_actions =
+      dynamic_cast<action_graph::ParallelActions &>(*action);
+  EXPECT_EQ(parallel_actions.GetGranularityStatistics().inline_executions, 1);
+}
+
+TEST(GenericActionBuilder, parallel_actions_with_max_concurrency) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  std::atomic<int> calls{0};
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions();
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [&calls](const ConfigurationNode &node, const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(
+            node, [&calls](const std::string &) { ++calls; });
+      });
+  const auto create_configuration = [](const std::string &max_concurrency) {
+    return MapNode{std::make_pair(
+        "action",
+        MapNode{std::make_pair("name", ScalarNode{"action"}),
+                std::make_pair("type", ScalarNode{"parallel_actions"}),
+                std::make_pair("max_concurrency", ScalarNode{max_concurrency}),
+                std::make_pair(
+                    "actions",
+                    SequenceNode{CreateCallbackActionNode("action1"),
+                                 CreateCallbackActionNode("action2")})})};
+  };
+
+  auto action = action_builder(create_configuration("1"));
+  action->Execute();
+
+  EXPECT_EQ(calls.load(), 2);
+  EXPECT_THROW(action_builder(create_configuration("0")),
+               action_graph::builder::ConfigurationError);
+}
+
+TEST(GenericActionBuilder, team_rejects_scheduling_options) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions();
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [](const ConfigurationNode &node, const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(node, [](const std::string &) {});
+      });
+  const auto create_configuration = [](const std::string &key,
+                                       const std::string &value) {
+    return MapNode{std::make_pair(
+        "action",
+        MapNode{std::make_pair("name", ScalarNode{"action"}),
+                std::make_pair("type", ScalarNode{"parallel_actions"}),
+                std::make_pair("mode", ScalarNode{"team"}),
+                std::make_pair(key, ScalarNode{value}),
+                std::make_pair(
+                    "actions",
+                    SequenceNode{CreateCallbackActionNode("action1"),
+                                 CreateCallbackActionNode("action2")})})};
+  };
+
+  EXPECT_THROW(action_builder(create_configuration("max_concurrency", "1")),
+               action_graph::builder::ConfigurationError);
+  EXPECT_THROW(
+      action_builder(create_configuration("adaptive_threshold", "1 seconds")),
+      action_graph::builder::ConfigurationError);
+}
+
+MapNode CreateDagActionNode(const std::string &name,
+                            const std::string &depends_on) {
+  return MapNode{std::make_pair(
+      "action",
+      MapNode{std::make_pair("name", ScalarNode{name}),
+              std::make_pair("type", ScalarNode{"callback_action"}),
+              std::make_pair("message", ScalarNode{name + " executed"}),
+              std::make_pair("depends_on", SequenceNode{ScalarNode{
+                                               depends_on}})})};
+}
+
+MapNode CreateDagActions(const std::string &publish_depends_on) {
+  return MapNode{std::make_pair(
+      "action",
+      MapNode{std::make_pair("name", ScalarNode{"action"}),
+              std::make_pair("type", ScalarNode{"dag_actions"}),
+              std::make_pair(
+                  "actions",
+                  SequenceNode{
+                      CreateDagActionNode("publish", publish_depends_on),
+                      CreateCallbackActionNode("load"),
+                      CreateDagActionNode("process", "load")})})};
+}
+
+TEST(GenericActionBuilder, dag_actions) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::CreateGenericActionBuilderWithDefaultActions;
+
+  action_graph::executors::InlineExecutor executor;
+  std::vector<std::string> messages;
+  auto action_builder = CreateGenericActionBuilderWithDefaultActions(executor);
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [&messages](const ConfigurationNode &node, const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(
+            node,
+            [&messages](const std::string &msg) { messages.push_back(msg); });
+      });
+
+  auto action = action_builder(CreateDagActions("process"));
+  action->Execute();
+
+  EXPECT_EQ(messages,
+            (std::vector<std::string>{"load executed", "process executed",
+                                      "publish executed"}));
+  EXPECT_THROW(action_builder(CreateDagActions("unknown")),
+               action_graph::builder::ConfigurationError);
+  EXPECT_THROW(action_builder(CreateDagActions("publish")),
+               action_graph::builder::ConfigurationError);
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/action_sequence.h>
+#include <action_graph/compiler/execution_plan.h>
+#include <action_graph/decorators/decorated_action.h>
+#include <action_graph/decorators/observable_action.h>
+#include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using action_graph::Action;
+using action_graph::ActionSequence;
+using action_graph::ParallelActions;
+using action_graph::SingleAction;
+using action_graph::compiler::CompilePlan;
+using action_graph::compiler::ExecutionPlan;
+
+namespace {
+
+class Decorator final : public action_graph::decorators::DecoratedAction {
+public:
+  Decorator(std::unique_ptr<Action> action, bool is_no_op)
+      : DecoratedAction(std::move(action)), is_no_op_(is_no_op) {}
+
+  void Execute() override { GetAction().Execute(); }
+
+  bool IsNoOp() const noexcept override { return is_no_op_; }
+
+private:
+  const bool is_no_op_;
+};
+
+std::unique_ptr<Action> Leaf(const std::string &name) {
+  return std::make_unique<SingleAction>(name, []() {});
+}
+
+template <class... Actions>
+std::unique_ptr<Action> Sequence(std::unique_ptr<Actions>... actions) {
+  return std::make_unique<ActionSequence>("sequence", std::move(actions)...);
+}
+
+template <class... Actions>
+std::unique_ptr<Action> Parallel(std::unique_ptr<Actions>... actions) {
+  return std::make_unique<ParallelActions>("parallel", std::move(actions)...);
+}
+
+std::vector<std::string> StepActions(const ExecutionPlan &plan,
+                                     std::size_t step) {
+  std::vector<std::string> names;
+  const auto &plan_step = plan.steps[step];
+  for (auto action = plan_step.first_action;
+       action < plan_step.first_action + plan_step.action_count; ++action) {
+    names.push_back(plan.actions[action]->name);
+  }
+  return names;
+}
+
+std::vector<std::size_t> StepSuccessors(const ExecutionPlan &plan,
+                                        std::size_t step) {
+  const auto &plan_step = plan.steps[step];
+  const auto first = plan.successors.begin() + plan_step.first_successor;
+  return {first, first + plan_step.successor_count};
+}
+
+} // namespace
+
+TEST(CompilePlan, merges_nested_sequences_into_one_step) {
+  auto plan =
+      CompilePlan(Sequence(Leaf("a"), Sequence(Leaf("b"), Sequence(Leaf("c"))),
+                           std::make_unique<Decorator>(Leaf("d"), true)));
+
+  EXPECT_EQ(plan.name, "sequence");
+  ASSERT_EQ(plan.steps.size(), 1);
+  EXPECT_EQ(StepActions(plan, 0),
+            (std::vector<std::string>{"a", "b", "c", "d"}));
+  EXPECT_EQ(plan.steps[0].predecessor_count, 0);
+  EXPECT_TRUE(plan.successors.empty());
+}
+
+TEST(CompilePlan, runs_parallel_branches_in_steps_of_their_own) {
+  auto plan = CompilePlan(Sequence(
+      Leaf("a"), Parallel(Leaf("b"), Sequence(Leaf("c"), Leaf("d"))),
+      Leaf("e")));
+
+  ASSERT_EQ(plan.steps.size(), 4);
+  EXPECT_EQ(StepActions(plan, 0), (std::vector<std::string>{"a"}));
+  EXPECT_EQ(StepActions(plan, 1), (std::vector<std::string>{"b"}));
+  EXPECT_EQ(StepActions(plan, 2), (std::vector<std::string>{"c", "d"}));
+  EXPECT_EQ(StepActions(plan, 3), (std::vector<std::string>{"e"}));
+  EXPECT_EQ(StepSuccessors(plan, 0), (std::vector<std::size_t>{1, 2}));
+  EXPECT_EQ(StepSuccessors(plan, 1), (std::vector<std::size_t>{3}));
+  EXPECT_EQ(StepSuccessors(plan, 2), (std::vector<std::size_t>{3}));
+  EXPECT_EQ(plan.steps[3].predecessor_count, 2);
+}
+
+TEST(CompilePlan, merges_nested_parallel_actions) {
+  auto plan =
+      CompilePlan(Parallel(Parallel(Leaf("a"), Leaf("b")), Leaf("c")));
+
+  ASSERT_EQ(plan.steps.size(), 3);
+  for (const auto &step : plan.steps) {
+    EXPECT_EQ(step.predecessor_count, 0);
+    EXPECT_EQ(step.action_count, 1);
+  }
+}
+
+TEST(CompilePlan, joins_consecutive_parallel_actions_once) {
+  auto plan = CompilePlan(Sequence(Parallel(Leaf("a"), Leaf("b")),
+                                   Parallel(Leaf("c"), Leaf("d"))));
+
+  ASSERT_EQ(plan.steps.size(), 5);
+  EXPECT_EQ(plan.steps[2].action_count, 0);
+  EXPECT_EQ(plan.steps[2].predecessor_count, 2);
+  EXPECT_EQ(StepSuccessors(plan, 2), (std::vector<std::size_t>{3, 4}));
+  EXPECT_EQ(plan.successors.size(), 4);
+}
+
+TEST(CompilePlan, keeps_a_decorator_with_its_subtree) {
+  auto plan = CompilePlan(Sequence(
+      Leaf("a"), std::make_unique<Decorator>(
+                     Parallel(Leaf("b"), Leaf("c")), false)));
+
+  ASSERT_EQ(plan.steps.size(), 1);
+  EXPECT_EQ(StepActions(plan, 0),
+            (std::vector<std::string>{"a", "parallel"}));
+}
+
+TEST(CompilePlan, replaces_a_single_child_by_the_child) {
+  auto plan = CompilePlan(Parallel(Sequence(Leaf("a"))));
+
+  ASSERT_EQ(plan.steps.size(), 1);
+  EXPECT_EQ(StepActions(plan, 0), (std::vector<std::string>{"a"}));
+}
+
+TEST(CompilePlan, keeps_the_order_around_an_empty_parallel_action) {
+  auto plan = CompilePlan(
+      Sequence(Leaf("a"), std::make_unique<ParallelActions>("empty"),
+               Leaf("b")));
+
+  ASSERT_EQ(plan.steps.size(), 1);
+  EXPECT_EQ(StepActions(plan, 0), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(CompilePlan, drops_an_observable_action_without_observer) {
+  using action_graph::decorators::NoOperationExecutionObserver;
+  using action_graph::decorators::ObservableAction;
+  auto plan = CompilePlan(std::make_unique<ObservableAction>(
+      Sequence(Leaf("a"), Leaf("b")),
+      std::make_unique<NoOperationExecutionObserver>()));
+
+  ASSERT_EQ(plan.steps.size(), 1);
+  EXPECT_EQ(StepActions(plan, 0), (std::vector<std::string>{"a", "b"}));
+}
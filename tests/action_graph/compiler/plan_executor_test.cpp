@@ -0,0 +1,182 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include "builder/callback_action.h"
+#include "executor_log.h"
+#include <action_graph/action_sequence.h>
+#include <action_graph/builder/generic_action_builder.h>
+#include <action_graph/compiler/execution_plan.h>
+#include <action_graph/compiler/plan_executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <native_configuration/map_node.h>
+#include <native_configuration/scalar_node.h>
+#include <native_configuration/sequence_node.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using action_graph::Action;
+using action_graph::ActionSequence;
+using action_graph::ParallelActions;
+using action_graph::SingleAction;
+using action_graph::compiler::CompilePlan;
+using action_graph::compiler::PlanExecutor;
+
+namespace {
+
+std::ptrdiff_t IndexOf(const std::vector<std::string> &entries,
+                       const std::string &entry) {
+  return std::find(entries.begin(), entries.end(), entry) - entries.begin();
+}
+
+} // namespace
+
+TEST(PlanExecutor, runs_a_single_step_on_the_executing_thread) {
+  std::vector<std::thread::id> threads;
+  const auto record_thread = [&threads]() {
+    threads.push_back(std::this_thread::get_id());
+  };
+  PlanExecutor plan{CompilePlan(std::make_unique<ActionSequence>(
+      "sequence", std::make_unique<SingleAction>("a", record_thread),
+      std::make_unique<SingleAction>("b", record_thread)))};
+
+  plan.Execute();
+
+  EXPECT_EQ(plan.GetPlan().steps.size(), 1);
+  EXPECT_EQ(threads, (std::vector<std::thread::id>(
+                         2, std::this_thread::get_id())));
+}
+
+TEST(PlanExecutor, keeps_the_order_of_the_tree) {
+  ExecutorLog log;
+  auto tree = std::make_unique<ActionSequence>(
+      "sequence", std::make_unique<LoggingAction>("a", log),
+      std::make_unique<ParallelActions>(
+          "parallel", std::make_unique<LoggingAction>("b", log),
+          std::make_unique<ActionSequence>(
+              "branch", std::make_unique<LoggingAction>("c", log),
+              std::make_unique<LoggingAction>("d", log))),
+      std::make_unique<LoggingAction>("e", log));
+  action_graph::executors::ThreadPool pool{2};
+  PlanExecutor plan{CompilePlan(std::move(tree)), pool};
+
+  plan.Execute();
+
+  const auto entries = log.GetLog();
+  ASSERT_EQ(entries.size(), 10);
+  EXPECT_LT(IndexOf(entries, "stop: a"), IndexOf(entries, "start: b"));
+  EXPECT_LT(IndexOf(entries, "stop: a"), IndexOf(entries, "start: c"));
+  EXPECT_LT(IndexOf(entries, "stop: c"), IndexOf(entries, "start: d"));
+  EXPECT_LT(IndexOf(entries, "stop: b"), IndexOf(entries, "start: e"));
+  EXPECT_LT(IndexOf(entries, "stop: d"), IndexOf(entries, "start: e"));
+}
+
+TEST(PlanExecutor, runs_a_built_graph) {
+  using action_graph::builder::ActionBuilder;
+  using action_graph::builder::ConfigurationNode;
+  using namespace action_graph::native_configuration;
+
+  std::mutex messages_mutex;
+  std::vector<std::string> messages;
+  auto action_builder =
+      action_graph::builder::CreateGenericActionBuilderWithDefaultActions();
+  action_builder.AddBuilderFunction(
+      "callback_action",
+      [&messages, &messages_mutex](const ConfigurationNode &node,
+                                   const ActionBuilder &) {
+        return CreateCallbackActionFromYaml(
+            node, [&messages, &messages_mutex](const std::string &message) {
+              std::lock_guard<std::mutex> lock(messages_mutex);
+              messages.push_back(message);
+            });
+      });
+  const auto callback_action = [](const std::string &name) {
+    return MapNode{std::make_pair(
+        "action",
+        MapNode{std::make_pair("name", ScalarNode{name}),
+                std::make_pair("type", ScalarNode{"callback_action"}),
+                std::make_pair("message", ScalarNode{name})})};
+  };
+  const MapNode configuration{std::make_pair(
+      "action",
+      MapNode{
+          std::make_pair("name", ScalarNode{"pipeline"}),
+          std::make_pair("type", ScalarNode{"sequential_actions"}),
+          std::make_pair(
+              "actions",
+              SequenceNode{
+                  callback_action("prepare"),
+                  MapNode{std::make_pair(
+                      "action",
+                      MapNode{std::make_pair("name", ScalarNode{"fan_out"}),
+                              std::make_pair("type",
+                                             ScalarNode{"parallel_actions"}),
+                              std::make_pair(
+                                  "actions",
+                                  SequenceNode{callback_action("left"),
+                                               callback_action("right")})})},
+                  callback_action("publish")})})};
+
+  PlanExecutor plan{CompilePlan(action_builder(configuration))};
+  plan.Execute();
+
+  ASSERT_EQ(messages.size(), 4);
+  EXPECT_EQ(messages.front(), "prepare");
+  EXPECT_EQ(messages.back(), "publish");
+  EXPECT_EQ(plan.GetPlan().steps.size(), 4);
+}
+
+// Runs the same plan on two threads at the same time, like a trigger with
+// the concurrent overrun policy.
+TEST(PlanExecutor, concurrent_executions) {
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  action_graph::executors::ThreadPool pool{2};
+  PlanExecutor plan{
+      CompilePlan(std::make_unique<ActionSequence>(
+          "sequence", std::make_unique<SingleAction>("a", count),
+          std::make_unique<ParallelActions>(
+              "parallel", std::make_unique<SingleAction>("b", count),
+              std::make_unique<SingleAction>("c", count)),
+          std::make_unique<SingleAction>("d", count))),
+      pool};
+  ASSERT_GT(plan.GetPlan().steps.size(), 1);
+  const auto execute = [&plan]() {
+    for (int execution = 0; execution < 20000; ++execution) {
+      plan.Execute();
+    }
+  };
+
+  std::thread other_thread(execute);
+  execute();
+  other_thread.join();
+
+  EXPECT_EQ(calls.load(), 2 * 20000 * 4);
+}
+
+TEST(PlanExecutor, rethrows_an_exception) {
+  action_graph::executors::InlineExecutor executor;
+  PlanExecutor plan{
+      CompilePlan(std::make_unique<ParallelActions>(
+          "parallel", std::make_unique<SingleAction>("a", []() {}),
+          std::make_unique<SingleAction>(
+              "b", []() { throw std::runtime_error("failed"); }))),
+      executor};
+
+  EXPECT_THROW(plan.Execute(), std::runtime_error);
+}
+
+TEST(PlanExecutor, executes_an_empty_plan) {
+  PlanExecutor plan{
+      CompilePlan(std::make_unique<ActionSequence>("empty"))};
+  plan.Execute();
+  EXPECT_TRUE(plan.GetPlan().steps.empty());
+}
@@ -0,0 +1,249 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include "executor_log.h"
+#include "failing_executor.h"
+#include <action_graph/dag_actions.h>
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/executors/work_stealing_pool.h>
+#include <action_graph/single_action.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using action_graph::DagActions;
+using action_graph::DagNode;
+using action_graph::SingleAction;
+
+namespace {
+
+DagNode LoggingNode(const std::string &name, ExecutorLog &log,
+                    std::vector<std::size_t> depends_on = {}) {
+  return DagNode{std::make_unique<LoggingAction>(name, log),
+                 std::move(depends_on)};
+}
+
+// a -> b, a -> c, b -> d, c -> d
+std::vector<DagNode> CreateDiamond(ExecutorLog &log) {
+  std::vector<DagNode> nodes;
+  nodes.push_back(LoggingNode("a", log));
+  nodes.push_back(LoggingNode("b", log, {0}));
+  nodes.push_back(LoggingNode("c", log, {0}));
+  nodes.push_back(LoggingNode("d", log, {1, 2}));
+  return nodes;
+}
+
+std::ptrdiff_t IndexOf(const std::vector<std::string> &entries,
+                       const std::string &entry) {
+  return std::find(entries.begin(), entries.end(), entry) - entries.begin();
+}
+
+// a -> b, a -> c, b -> d, c -> d
+std::vector<DagNode> CreateCountingDiamond(std::atomic<int> &calls) {
+  std::vector<std::vector<std::size_t>> dependencies{{}, {0}, {0}, {1, 2}};
+  std::vector<DagNode> nodes;
+  for (auto &depends_on : dependencies) {
+    nodes.push_back(DagNode{
+        std::make_unique<SingleAction>("node", [&calls]() { ++calls; }),
+        std::move(depends_on)});
+  }
+  return nodes;
+}
+
+void ExpectDiamondOrder(const std::vector<std::string> &entries) {
+  ASSERT_EQ(entries.size(), 8);
+  EXPECT_LT(IndexOf(entries, "stop: a"), IndexOf(entries, "start: b"));
+  EXPECT_LT(IndexOf(entries, "stop: a"), IndexOf(entries, "start: c"));
+  EXPECT_LT(IndexOf(entries, "stop: b"), IndexOf(entries, "start: d"));
+  EXPECT_LT(IndexOf(entries, "stop: c"), IndexOf(entries, "start: d"));
+}
+
+} // namespace
+
+TEST(DagActions, execute_on_new_threads) {
+  ExecutorLog log;
+  DagActions dag("dag", CreateDiamond(log));
+  dag.Execute();
+  ExpectDiamondOrder(log.GetLog());
+}
+
+TEST(DagActions, execute_on_executors) {
+  action_graph::executors::InlineExecutor inline_executor;
+  action_graph::executors::ThreadPool thread_pool{2};
+  action_graph::executors::WorkStealingPool work_stealing_pool{2};
+  for (action_graph::executors::Executor *executor :
+       {static_cast<action_graph::executors::Executor *>(&inline_executor),
+        static_cast<action_graph::executors::Executor *>(&thread_pool),
+        static_cast<action_graph::executors::Executor *>(
+            &work_stealing_pool)}) {
+    ExecutorLog log;
+    DagActions dag("dag", CreateDiamond(log), *executor);
+    dag.Execute();
+    ExpectDiamondOrder(log.GetLog());
+  }
+}
+
+TEST(DagActions, execute_repeatedly) {
+  std::atomic<int> calls{0};
+  std::vector<DagNode> nodes;
+  for (std::size_t node = 0; node < 4; ++node) {
+    std::vector<std::size_t> depends_on;
+    if (node > 0)
+      depends_on.push_back(node - 1);
+    nodes.push_back(DagNode{
+        std::make_unique<SingleAction>("node", [&calls]() { ++calls; }),
+        std::move(depends_on)});
+  }
+  action_graph::executors::ThreadPool pool{2};
+  DagActions dag("dag", std::move(nodes), pool);
+
+  for (int execution = 0; execution < 100; ++execution) {
+    dag.Execute();
+  }
+
+  EXPECT_EQ(calls.load(), 400);
+}
+
+// Runs the same graph on two threads at the same time, like a trigger with
+// the concurrent overrun policy.
+TEST(DagActions, concurrent_executions) {
+  std::atomic<int> calls{0};
+  action_graph::executors::ThreadPool pool{2};
+  DagActions dag("dag", CreateCountingDiamond(calls), pool);
+  const auto execute = [&dag]() {
+    for (int execution = 0; execution < 20000; ++execution) {
+      dag.Execute();
+    }
+  };
+
+  std::thread other_thread(execute);
+  execute();
+  other_thread.join();
+
+  EXPECT_EQ(calls.load(), 2 * 20000 * 4);
+}
+
+TEST(DagActions, passes_on_a_failed_post) {
+  std::atomic<int> calls{0};
+  action_graph::executors::ThreadPool pool{2};
+  FailingExecutor executor{pool, 0};
+  DagActions dag("dag", CreateCountingDiamond(calls), executor);
+
+  EXPECT_THROW(dag.Execute(), std::runtime_error);
+  // b and c are ready at once, so that posting a helper for one of them
+  // fails and both are skipped
+  EXPECT_EQ(calls.load(), 1);
+}
+
+// publish only needs load, so that it runs while process is still running.
+// Nested in a sequence of parallel actions, process would block publish.
+TEST(DagActions, starts_a_node_when_its_predecessors_finished) {
+  std::promise<void> published;
+  auto is_published = published.get_future().share();
+  bool was_published_before_process_finished = false;
+
+  std::vector<DagNode> nodes;
+  nodes.push_back(
+      DagNode{std::make_unique<SingleAction>("load", []() {}), {}});
+  nodes.push_back(DagNode{
+      std::make_unique<SingleAction>(
+          "process",
+          [&is_published, &was_published_before_process_finished]() {
+            was_published_before_process_finished =
+                is_published.wait_for(std::chrono::seconds(10)) ==
+                std::future_status::ready;
+          }),
+      {}});
+  nodes.push_back(DagNode{
+      std::make_unique<SingleAction>("publish",
+                                     [&published]() { published.set_value(); }),
+      {0}});
+  action_graph::executors::ThreadPool pool{2};
+  DagActions dag("dag", std::move(nodes), pool);
+
+  dag.Execute();
+
+  EXPECT_TRUE(was_published_before_process_finished);
+}
+
+TEST(DagActions, nests_on_a_single_thread) {
+  action_graph::executors::ThreadPool pool{1};
+  std::atomic<int> calls{0};
+  std::vector<DagNode> outer_nodes;
+  for (std::size_t outer = 0; outer < 3; ++outer) {
+    std::vector<DagNode> inner_nodes;
+    for (std::size_t inner = 0; inner < 3; ++inner) {
+      inner_nodes.push_back(DagNode{
+          std::make_unique<SingleAction>("inner", [&calls]() { ++calls; }),
+          {}});
+    }
+    outer_nodes.push_back(DagNode{
+        std::make_unique<DagActions>("inner", std::move(inner_nodes), pool),
+        {}});
+  }
+  DagActions dag("outer", std::move(outer_nodes), pool);
+
+  dag.Execute();
+
+  EXPECT_EQ(calls.load(), 9);
+}
+
+TEST(DagActions, skips_successors_of_a_failed_node) {
+  bool is_failing = true;
+  bool is_successor_run = false;
+  std::vector<DagNode> nodes;
+  nodes.push_back(DagNode{std::make_unique<SingleAction>(
+                              "failing",
+                              [&is_failing]() {
+                                if (is_failing)
+                                  throw std::runtime_error("failed");
+                              }),
+                          {}});
+  nodes.push_back(DagNode{
+      std::make_unique<SingleAction>(
+          "successor", [&is_successor_run]() { is_successor_run = true; }),
+      {0}});
+  action_graph::executors::InlineExecutor executor;
+  DagActions dag("dag", std::move(nodes), executor);
+
+  EXPECT_THROW(dag.Execute(), std::runtime_error);
+  EXPECT_FALSE(is_successor_run);
+
+  is_failing = false;
+  dag.Execute();
+  EXPECT_TRUE(is_successor_run);
+}
+
+TEST(DagActions, rejects_invalid_dependencies) {
+  ExecutorLog log;
+  std::vector<DagNode> cycle;
+  cycle.push_back(LoggingNode("a", log));
+  cycle.push_back(LoggingNode("b", log, {0, 2}));
+  cycle.push_back(LoggingNode("c", log, {1}));
+  EXPECT_THROW(DagActions("dag", std::move(cycle)), std::invalid_argument);
+
+  std::vector<DagNode> self_dependency;
+  self_dependency.push_back(LoggingNode("a", log, {0}));
+  EXPECT_THROW(DagActions("dag", std::move(self_dependency)),
+               std::invalid_argument);
+
+  std::vector<DagNode> unknown;
+  unknown.push_back(LoggingNode("a", log, {1}));
+  EXPECT_THROW(DagActions("dag", std::move(unknown)), std::invalid_argument);
+}
+
+TEST(DagActions, execute_without_nodes) {
+  DagActions dag("dag", {});
+  dag.Execute();
+}
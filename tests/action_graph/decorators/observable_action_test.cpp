@@ -74,3 +74,16 @@ TEST(ObservableAction, execute_with_exception) {
   EXPECT_EQ(log.str(), "Execution started."
                        "Execution failed: This Action always throws.");
 }
+
+TEST(ObservableAction, is_no_op_with_a_no_operation_observer) {
+  using action_graph::decorators::NoOperationExecutionObserver;
+  using action_graph::decorators::ObservableAction;
+  std::stringstream log;
+  ObservableAction silent(std::make_unique<NoOperationAction>(log),
+                          std::make_unique<NoOperationExecutionObserver>());
+  ObservableAction observed(std::make_unique<NoOperationAction>(log),
+                            std::make_unique<TestExecutionObserver>(log));
+
+  EXPECT_TRUE(silent.IsNoOp());
+  EXPECT_FALSE(observed.IsNoOp());
+}
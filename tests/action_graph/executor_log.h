@@ -7,6 +7,7 @@
 
 #include <action_graph/action.h>
 #include <gtest/gtest.h>
+#include <mutex>
 #include <thread>
 
 class ExecutorLog {
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/executors/work_stealing_pool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using action_graph::executors::Executor;
+using action_graph::executors::InlineExecutor;
+using action_graph::executors::ThreadPerTaskExecutor;
+using action_graph::executors::ThreadPool;
+using action_graph::executors::WorkStealingPool;
+
+TEST(InlineExecutor, runs_on_the_calling_thread) {
+  InlineExecutor executor;
+  std::thread::id post_thread;
+  executor.Post([&post_thread]() { post_thread = std::this_thread::get_id(); });
+  EXPECT_EQ(post_thread, std::this_thread::get_id());
+
+  const auto caller = std::this_thread::get_id();
+  std::vector<std::size_t> indices;
+  executor.RunAll(3, [caller, &indices](std::size_t index) {
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    indices.push_back(index);
+  });
+  EXPECT_EQ(indices, (std::vector<std::size_t>{0, 1, 2}));
+}
+
+TEST(ThreadPerTaskExecutor, posts_to_a_new_thread) {
+  ThreadPerTaskExecutor executor;
+  std::promise<std::thread::id> post_thread;
+  executor.Post([&post_thread]() {
+    post_thread.set_value(std::this_thread::get_id());
+  });
+  EXPECT_NE(post_thread.get_future().get(), std::this_thread::get_id());
+}
+
+// The same expectations hold for every executor.
+class RunAllTest : public ::testing::TestWithParam<int> {
+protected:
+  void SetUp() override {
+    switch (GetParam()) {
+    case 0:
+      executor_ = std::make_unique<InlineExecutor>();
+      break;
+    case 1:
+      executor_ = std::make_unique<ThreadPerTaskExecutor>();
+      break;
+    case 2:
+      executor_ = std::make_unique<ThreadPool>(2);
+      break;
+    default:
+      executor_ = std::make_unique<WorkStealingPool>(2);
+      break;
+    }
+  }
+
+  Executor &executor() { return *executor_; }
+
+private:
+  std::unique_ptr<Executor> executor_{};
+};
+
+TEST_P(RunAllTest, calls_every_index_once) {
+  std::vector<std::atomic<int>> calls(50);
+  executor().RunAll(calls.size(),
+                    [&calls](std::size_t index) { ++calls[index]; });
+  for (const auto &count : calls) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST_P(RunAllTest, runs_nothing_without_calls) {
+  executor().RunAll(0, [](std::size_t) { FAIL(); });
+}
+
+TEST_P(RunAllTest, nests) {
+  std::atomic<int> calls{0};
+  executor().RunAll(4, [this, &calls](std::size_t) {
+    executor().RunAll(4, [&calls](std::size_t) { ++calls; });
+  });
+  EXPECT_EQ(calls.load(), 16);
+}
+
+TEST_P(RunAllTest, rethrows_an_exception) {
+  EXPECT_THROW(executor().RunAll(4,
+                                 [](std::size_t index) {
+                                   if (index == 2)
+                                     throw std::runtime_error("failed");
+                                 }),
+               std::runtime_error);
+}
+
+TEST_P(RunAllTest, posts) {
+  std::promise<void> is_run;
+  executor().Post([&is_run]() { is_run.set_value(); });
+  is_run.get_future().wait();
+}
+
+INSTANTIATE_TEST_SUITE_P(Executors, RunAllTest, ::testing::Range(0, 4));
+
+TEST(ThreadPool, run_all_helps_with_the_calls) {
+  ThreadPool pool{1};
+  std::promise<void> release_worker;
+  auto released = release_worker.get_future().share();
+  pool.Post([released]() { released.wait(); });
+
+  std::thread::id caller;
+  pool.RunAll(1, [&caller](std::size_t) {
+    caller = std::this_thread::get_id();
+  });
+  release_worker.set_value();
+  EXPECT_EQ(caller, std::this_thread::get_id());
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_configuration.h>
+#include <action_graph/executors/thread_pool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using action_graph::executors::ConfiguredThread;
+using action_graph::executors::SchedulingPolicy;
+using action_graph::executors::ThreadConfiguration;
+
+namespace {
+std::string CurrentThreadName() {
+#ifdef __linux__
+  char name[16]{};
+  pthread_getname_np(pthread_self(), name, sizeof(name));
+  return name;
+#else
+  return {};
+#endif
+}
+} // namespace
+
+TEST(ConfiguredThread, runs_function_and_joins) {
+  std::atomic<bool> has_run{false};
+  {
+    ConfiguredThread thread(ThreadConfiguration{},
+                            [&has_run]() { has_run = true; });
+    EXPECT_TRUE(thread.Joinable());
+  }
+  EXPECT_TRUE(has_run.load());
+}
+
+TEST(ConfiguredThread, move) {
+  std::atomic<int> counter{0};
+  ConfiguredThread thread(ThreadConfiguration{}, [&counter]() { ++counter; });
+  ConfiguredThread moved_thread(std::move(thread));
+  EXPECT_FALSE(thread.Joinable());
+  moved_thread.Join();
+  EXPECT_FALSE(moved_thread.Joinable());
+  EXPECT_EQ(counter.load(), 1);
+}
+
+#ifdef __linux__
+TEST(ConfiguredThread, name_affinity_and_stack_size) {
+  ThreadConfiguration configuration;
+  configuration.name = "configured_thread_name";
+  configuration.cpu_affinity = {0};
+  configuration.stack_size = 1024 * 1024;
+
+  std::string name;
+  int cpu{-1};
+  std::size_t stack_size{0};
+  bool is_applied{false};
+  ConfiguredThread(configuration, [&]() {
+    is_applied = ApplyToCurrentThread(configuration);
+    name = CurrentThreadName();
+    cpu = sched_getcpu();
+    pthread_attr_t attributes;
+    pthread_getattr_np(pthread_self(), &attributes);
+    pthread_attr_getstacksize(&attributes, &stack_size);
+    pthread_attr_destroy(&attributes);
+  }).Join();
+
+  EXPECT_TRUE(is_applied);
+  EXPECT_EQ(name, "configured_thre");
+  EXPECT_EQ(cpu, 0);
+  EXPECT_GE(stack_size, configuration.stack_size);
+}
+#endif
+
+TEST(ConfiguredThread, real_time_scheduling_falls_back) {
+  ThreadConfiguration configuration;
+  configuration.scheduling_policy = SchedulingPolicy::kFifo;
+  configuration.priority = 1000;
+  std::atomic<bool> has_run{false};
+  ConfiguredThread(configuration, [&has_run]() { has_run = true; }).Join();
+  EXPECT_TRUE(has_run.load());
+}
+
+TEST(ConfiguredThread, reports_whether_the_configuration_is_applied) {
+  ConfiguredThread thread(ThreadConfiguration{}, []() {});
+  EXPECT_TRUE(thread.IsConfigurationApplied());
+  thread.Join();
+  EXPECT_TRUE(thread.IsConfigurationApplied());
+
+  ConfiguredThread not_started;
+  EXPECT_THROW(not_started.IsConfigurationApplied(), std::logic_error);
+
+#ifdef __linux__
+  // the CPU does not fit into a cpu_set_t
+  ThreadConfiguration configuration;
+  configuration.cpu_affinity = {CPU_SETSIZE};
+  ConfiguredThread unpinned(configuration, []() {});
+  EXPECT_FALSE(unpinned.IsConfigurationApplied());
+
+  action_graph::executors::ThreadPool pool{2, configuration};
+  EXPECT_FALSE(pool.AreWorkersConfigured());
+#endif
+  action_graph::executors::ThreadPool configured_pool{2};
+  EXPECT_TRUE(configured_pool.AreWorkersConfigured());
+}
+
+TEST(ThreadPool, names_workers) {
+  ThreadConfiguration configuration;
+  configuration.name = "worker";
+  std::mutex names_mutex;
+  std::set<std::string> names;
+  {
+    action_graph::executors::ThreadPool pool{2, configuration};
+    std::atomic<int> started{0};
+    for (int task = 0; task < 2; ++task) {
+      pool.Post([&]() {
+        {
+          std::lock_guard<std::mutex> lock(names_mutex);
+          names.insert(CurrentThreadName());
+        }
+        ++started;
+        // keeps this worker busy, so that the other task runs on the other
+        while (started.load() < 2) {
+          std::this_thread::yield();
+        }
+      });
+    }
+  }
+#ifdef __linux__
+  EXPECT_EQ(names, (std::set<std::string>{"worker0", "worker1"}));
+#endif
+}
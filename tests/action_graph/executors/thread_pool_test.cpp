@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_pool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using action_graph::executors::ThreadPool;
+
+TEST(ThreadPool, requires_threads) {
+  EXPECT_THROW(ThreadPool{0}, std::invalid_argument);
+}
+
+TEST(ThreadPool, thread_count) {
+  ThreadPool pool{3};
+  EXPECT_EQ(pool.ThreadCount(), 3);
+  EXPECT_GE(ThreadPool::DefaultThreadCount(), 2);
+}
+
+TEST(ThreadPool, runs_posted_tasks_before_destruction) {
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool{2};
+    for (int task = 0; task < 100; ++task) {
+      pool.Post([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPool, reuses_its_threads) {
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  {
+    ThreadPool pool{2};
+    for (int task = 0; task < 100; ++task) {
+      pool.Post([&thread_ids, &thread_ids_mutex]() {
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        thread_ids.insert(std::this_thread::get_id());
+      });
+    }
+  }
+  EXPECT_LE(thread_ids.size(), 2);
+  EXPECT_EQ(thread_ids.count(std::this_thread::get_id()), 0);
+}
+
+TEST(ThreadPool, starts_earliest_deadline_first) {
+  std::mutex order_mutex;
+  std::vector<int> order;
+  const auto record = [&order, &order_mutex](int value) {
+    return [&order, &order_mutex, value]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(value);
+    };
+  };
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  {
+    ThreadPool pool{1};
+    pool.Post([released]() { released.wait(); });
+    pool.Post(record(0));
+    pool.Post(record(30), std::chrono::nanoseconds{30});
+    pool.Post(record(10), std::chrono::nanoseconds{10});
+    pool.Post(record(20), std::chrono::nanoseconds{20});
+    pool.Post(record(11), std::chrono::nanoseconds{10});
+    release.set_value();
+  }
+  EXPECT_EQ(order, (std::vector<int>{10, 11, 20, 30, 0}));
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/work_stealing_deque.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using action_graph::executors::WorkStealingDeque;
+
+TEST(WorkStealingDeque, owner_pops_last_pushed) {
+  WorkStealingDeque<int> deque;
+  int items[3]{0, 1, 2};
+  for (auto &item : items) {
+    deque.Push(&item);
+  }
+  EXPECT_EQ(deque.Pop(), &items[2]);
+  EXPECT_EQ(deque.Pop(), &items[1]);
+  EXPECT_EQ(deque.Pop(), &items[0]);
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(WorkStealingDeque, thief_steals_first_pushed) {
+  WorkStealingDeque<int> deque;
+  int items[3]{0, 1, 2};
+  for (auto &item : items) {
+    deque.Push(&item);
+  }
+  EXPECT_EQ(deque.Steal(), &items[0]);
+  EXPECT_EQ(deque.Steal(), &items[1]);
+  EXPECT_EQ(deque.Pop(), &items[2]);
+  EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+TEST(WorkStealingDeque, grows) {
+  WorkStealingDeque<int> deque;
+  std::vector<int> items(1000);
+  for (auto &item : items) {
+    deque.Push(&item);
+  }
+  for (auto item = items.rbegin(); item != items.rend(); ++item) {
+    EXPECT_EQ(deque.Pop(), &*item);
+  }
+}
+
+TEST(WorkStealingDeque, every_item_is_taken_once) {
+  constexpr int kItemCount = 100000;
+  WorkStealingDeque<int> deque;
+  std::vector<int> items(kItemCount, 0);
+  std::vector<std::atomic<int>> taken(kItemCount);
+  std::atomic<int> taken_count{0};
+  const auto take = [&items, &taken, &taken_count](int *item) {
+    ++taken[item - items.data()];
+    ++taken_count;
+  };
+
+  std::vector<std::thread> thieves;
+  for (int thief = 0; thief < 3; ++thief) {
+    thieves.emplace_back([&deque, &taken_count, &take]() {
+      while (taken_count.load() < kItemCount) {
+        auto *item = deque.Steal();
+        if (item != nullptr)
+          take(item);
+      }
+    });
+  }
+  for (int index = 0; index < kItemCount; ++index) {
+    deque.Push(&items[index]);
+    if (index % 3 == 0) {
+      auto *item = deque.Pop();
+      if (item != nullptr)
+        take(item);
+    }
+  }
+  while (taken_count.load() < kItemCount) {
+    auto *item = deque.Pop();
+    if (item != nullptr)
+      take(item);
+  }
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+
+  for (const auto &count : taken) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
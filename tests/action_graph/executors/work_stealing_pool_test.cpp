@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/work_stealing_pool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+using action_graph::executors::TaskGroup;
+using action_graph::executors::WorkStealingPool;
+
+TEST(WorkStealingPool, requires_threads) {
+  EXPECT_THROW(WorkStealingPool{0}, std::invalid_argument);
+}
+
+TEST(WorkStealingPool, runs_all_tasks_of_a_group) {
+  WorkStealingPool pool{2};
+  std::atomic<int> counter{0};
+  TaskGroup group;
+  for (int task = 0; task < 1000; ++task) {
+    pool.Submit(group, [&counter]() { ++counter; });
+  }
+  pool.Wait(group);
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(WorkStealingPool, nested_groups_do_not_deadlock) {
+  WorkStealingPool pool{1};
+  std::atomic<int> leaves{0};
+  std::function<void(int)> fork = [&](int depth) {
+    if (depth == 0) {
+      ++leaves;
+      return;
+    }
+    TaskGroup group;
+    for (int child = 0; child < 4; ++child) {
+      pool.Submit(group, [&fork, depth]() { fork(depth - 1); });
+    }
+    pool.Wait(group);
+  };
+
+  fork(5);
+
+  EXPECT_EQ(leaves.load(), 1024);
+}
+
+TEST(WorkStealingPool, waiting_thread_helps) {
+  WorkStealingPool pool{1};
+  std::atomic<bool> is_blocked{false};
+  std::atomic<bool> is_released{false};
+  TaskGroup blocking_group;
+  pool.Submit(blocking_group, [&is_blocked, &is_released]() {
+    is_blocked = true;
+    while (!is_released) {
+      std::this_thread::yield();
+    }
+  });
+  while (!is_blocked) {
+    std::this_thread::yield();
+  }
+
+  const auto caller = std::this_thread::get_id();
+  std::thread::id executor;
+  TaskGroup group;
+  pool.Submit(group, [&executor]() { executor = std::this_thread::get_id(); });
+  pool.Wait(group);
+  is_released = true;
+  pool.Wait(blocking_group);
+
+  EXPECT_EQ(executor, caller);
+}
+
+TEST(WorkStealingPool, rethrows_exception) {
+  WorkStealingPool pool{2};
+  std::atomic<int> counter{0};
+  TaskGroup group;
+  pool.Submit(group, []() { throw std::runtime_error("failed"); });
+  for (int task = 0; task < 10; ++task) {
+    pool.Submit(group, [&counter]() { ++counter; });
+  }
+  EXPECT_THROW(pool.Wait(group), std::runtime_error);
+  EXPECT_EQ(counter.load(), 10);
+}
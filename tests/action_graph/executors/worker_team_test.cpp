@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/worker_team.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using action_graph::executors::WorkerTeam;
+using action_graph::executors::WorkerTeamOptions;
+
+TEST(WorkerTeam, runs_the_task_once_per_member_and_release) {
+  std::vector<std::atomic<int>> calls(3);
+  WorkerTeam team{3, [&calls](std::size_t member) { ++calls[member]; }};
+  EXPECT_EQ(team.MemberCount(), 3);
+
+  for (int release = 0; release < 100; ++release) {
+    team.Release();
+    team.Join();
+  }
+
+  for (const auto &count : calls) {
+    EXPECT_EQ(count.load(), 100);
+  }
+}
+
+TEST(WorkerTeam, keeps_its_threads) {
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  WorkerTeam team{2, [&thread_ids, &thread_ids_mutex](std::size_t) {
+                    std::lock_guard<std::mutex> lock(thread_ids_mutex);
+                    thread_ids.insert(std::this_thread::get_id());
+                  }};
+
+  for (int release = 0; release < 10; ++release) {
+    team.Release();
+    team.Join();
+  }
+
+  EXPECT_EQ(thread_ids.size(), 2);
+  EXPECT_EQ(thread_ids.count(std::this_thread::get_id()), 0);
+}
+
+TEST(WorkerTeam, sleeps_without_spinning) {
+  std::atomic<int> calls{0};
+  WorkerTeamOptions options;
+  options.spin_duration = std::chrono::nanoseconds::zero();
+  WorkerTeam team{2, [&calls](std::size_t) { ++calls; }, options};
+
+  for (int release = 0; release < 10; ++release) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    team.Release();
+    team.Join();
+  }
+
+  EXPECT_EQ(calls.load(), 20);
+}
+
+TEST(WorkerTeam, rethrows_an_exception_of_a_member) {
+  WorkerTeam team{2, [](std::size_t member) {
+                    if (member == 1)
+                      throw std::runtime_error("failed");
+                  }};
+
+  team.Release();
+  EXPECT_THROW(team.Join(), std::runtime_error);
+  team.Release();
+  EXPECT_THROW(team.Join(), std::runtime_error);
+}
+
+TEST(WorkerTeam, without_members) {
+  WorkerTeam team{0, [](std::size_t) { FAIL(); }};
+  team.Release();
+  team.Join();
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef TESTS_ACTION_GRAPH_FAILING_EXECUTOR_H_
+#define TESTS_ACTION_GRAPH_FAILING_EXECUTOR_H_
+
+#include <action_graph/executors/executor.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Passes the first tasks on to another executor and throws on every further
+// Post, like a pool which is stopping or out of memory.
+class FailingExecutor final : public action_graph::executors::Executor {
+public:
+  FailingExecutor(action_graph::executors::Executor &executor,
+                  std::size_t successful_posts)
+      : executor_(executor), remaining_posts_(successful_posts) {}
+
+  void Post(std::function<void()> task) override {
+    if (remaining_posts_.load() == 0) {
+      throw std::runtime_error("The executor does not accept tasks.");
+    }
+    --remaining_posts_;
+    executor_.Post(std::move(task));
+  }
+
+  void Post(std::function<void()> task, std::chrono::nanoseconds) override {
+    Post(std::move(task));
+  }
+
+  void RunAll(std::size_t count,
+              const std::function<void(std::size_t)> &task) override {
+    executor_.RunAll(count, task);
+  }
+
+private:
+  action_graph::executors::Executor &executor_;
+  std::atomic<std::size_t> remaining_posts_;
+};
+
+#endif // TESTS_ACTION_GRAPH_FAILING_EXECUTOR_H_
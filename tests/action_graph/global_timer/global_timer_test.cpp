@@ -3,7 +3,10 @@
 // This file is part of the action_graph library and is licensed under the MIT
 // License. See the LICENSE file in the root directory for full license text.
 
+#include "action_graph/global_timer/condition_variable_waiter.h"
 #include "action_graph/global_timer/global_timer.h"
+#include "action_graph/global_timer/schedule.h"
+#include "action_graph/global_timer/simulated_timer.h"
 #include <gtest/gtest.h>
 
 using action_graph::GlobalTimer;
@@ -11,9 +14,19 @@ using action_graph::GlobalTimer;
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "test_clock.h"
 
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
 using std::chrono::milliseconds;
 using std::chrono::seconds;
 
@@ -142,3 +155,639 @@ TEST_F(GlobalTimerTest, mix_high_frequency_with_low_frequency) {
         << "Expected log entry not found: " << expected_log_entry;
   }
 }
+
+// Sleeps like the default waiter and records the deadlines the timer thread
+// sleeps until.
+class RecordingWaiter {
+public:
+  using TimePoint = TestClock::time_point;
+
+  template <typename IsAwake>
+  void Wait(std::unique_lock<std::mutex> &lock, IsAwake is_awake) {
+    waiter_.Wait(lock, is_awake);
+  }
+
+  template <typename IsAwake>
+  void WaitUntil(std::unique_lock<std::mutex> &lock, const TimePoint &deadline,
+                 IsAwake is_awake) {
+    {
+      std::lock_guard<std::mutex> deadlines_lock(deadlines_mutex_);
+      deadlines_.push_back(deadline);
+    }
+    waiter_.WaitUntil(lock, deadline, is_awake);
+  }
+
+  void NotifyAll() { waiter_.NotifyAll(); }
+
+  static std::vector<TimePoint> TakeDeadlines() {
+    std::lock_guard<std::mutex> lock(deadlines_mutex_);
+    auto deadlines = std::move(deadlines_);
+    deadlines_.clear();
+    return deadlines;
+  }
+
+private:
+  action_graph::ConditionVariableWaiter<TestClock> waiter_{};
+  static std::mutex deadlines_mutex_;
+  static std::vector<TimePoint> deadlines_;
+};
+
+std::mutex RecordingWaiter::deadlines_mutex_{};
+std::vector<RecordingWaiter::TimePoint> RecordingWaiter::deadlines_{};
+
+TEST_F(GlobalTimerTest, sleeps_until_next_trigger) {
+  using Timer =
+      GlobalTimer<TestClock, action_graph::HeapSchedule<TestClock::time_point>,
+                  RecordingWaiter>;
+  RecordingWaiter::TakeDeadlines();
+  std::atomic<size_t> trigger_counter{0};
+  {
+    Timer timer{};
+    timer.SetTriggerTime(milliseconds{50},
+                         [&trigger_counter]() { ++trigger_counter; });
+    for (int loop = 0; loop < 5; ++loop) {
+      TestClock::advance_time(milliseconds{50});
+      timer.WaitOneCycle();
+    }
+  }
+
+  EXPECT_EQ(trigger_counter.load(), 5);
+  // after every fire, the timer thread sleeps until the next deadline
+  const auto deadlines = RecordingWaiter::TakeDeadlines();
+  for (int period = 2; period <= 6; ++period) {
+    const TestClock::time_point deadline{milliseconds{50 * period}};
+    EXPECT_NE(std::find(deadlines.begin(), deadlines.end(), deadline),
+              deadlines.end());
+  }
+}
+
+TEST_F(GlobalTimerTest, callbacks_run_on_worker_pool) {
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  const auto record_thread = [&thread_ids, &thread_ids_mutex]() {
+    std::lock_guard<std::mutex> lock(thread_ids_mutex);
+    thread_ids.insert(std::this_thread::get_id());
+  };
+
+  action_graph::executors::ThreadPool pool{2};
+  {
+    GlobalTimer<TestClock> timer{pool};
+    timer.SetTriggerTime(milliseconds{1}, record_thread);
+    timer.SetTriggerTime(milliseconds{1}, record_thread);
+    timer.SetTriggerTime(milliseconds{2}, record_thread);
+
+    for (int loop = 0; loop < 20; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+  }
+  EXPECT_GE(thread_ids.size(), 1);
+  EXPECT_LE(thread_ids.size(), pool.ThreadCount());
+}
+
+// The callback of "slow" runs longer than its period in real time, but the
+// simulated time only advances after it finished, so every fire executes.
+TEST_F(GlobalTimerTest, trigger_statistics) {
+  action_graph::executors::ThreadPool pool{2};
+  action_graph::SimulatedTimer<TestClock> timer{pool};
+
+  action_graph::TriggerOptions slow_options;
+  slow_options.name = "slow";
+  slow_options.overrun_policy = action_graph::OverrunPolicy::kCoalesce;
+  timer.SetTriggerTime(
+      milliseconds{1},
+      []() { std::this_thread::sleep_for(milliseconds{2}); }, slow_options);
+  action_graph::TriggerOptions fast_options;
+  fast_options.name = "fast";
+  timer.SetTriggerTime(milliseconds{2}, []() {}, fast_options);
+
+  for (int loop = 0; loop < 4; ++loop) {
+    timer.RunFor(milliseconds{1});
+  }
+
+  const auto statistics = timer.GetTriggerStatistics();
+  ASSERT_EQ(statistics.size(), 2);
+  EXPECT_EQ(statistics[0].name, "slow");
+  EXPECT_EQ(statistics[0].statistics.executed, 4);
+  EXPECT_EQ(statistics[0].statistics.coalesced, 0);
+  EXPECT_EQ(statistics[0].statistics.dropped, 0);
+  EXPECT_EQ(statistics[1].name, "fast");
+  EXPECT_EQ(statistics[1].statistics.executed, 2);
+  EXPECT_EQ(statistics[1].statistics.coalesced, 0);
+  EXPECT_EQ(statistics[1].statistics.dropped, 0);
+}
+
+TEST_F(GlobalTimerTest, phase) {
+  std::vector<int> trigger_times;
+  {
+    GlobalTimer<TestClock> timer{};
+    action_graph::TriggerOptions options;
+    options.phase = milliseconds{2};
+    options.has_phase = true;
+    timer.SetTriggerTime(
+        milliseconds{4},
+        [&trigger_times]() {
+          trigger_times.push_back(
+              static_cast<int>(TestClock::now().time_since_epoch().count()));
+        },
+        options);
+
+    for (int loop = 1; loop <= 10; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+  }
+  EXPECT_EQ(trigger_times, (std::vector<int>{6, 10}));
+}
+
+TEST_F(GlobalTimerTest, stagger_triggers_with_same_period) {
+  ThreadSafeLog log;
+  {
+    action_graph::GlobalTimerOptions timer_options;
+    timer_options.stagger_triggers = true;
+    GlobalTimer<TestClock> timer{timer_options};
+    for (const std::string name : {"A", "B", "C"}) {
+      timer.SetTriggerTime(milliseconds{3}, [&log, name]() {
+        log.Log(name + std::to_string(
+                           TestClock::now().time_since_epoch().count()));
+      });
+    }
+
+    for (int loop = 1; loop <= 8; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+  }
+  const std::vector<std::string> expected_log{"A3", "B4", "C5",
+                                              "A6", "B7", "C8"};
+  EXPECT_EQ(log.GetLog(), expected_log);
+}
+
+TEST_F(GlobalTimerTest, explicit_phase_is_not_staggered) {
+  ThreadSafeLog log;
+  {
+    action_graph::GlobalTimerOptions timer_options;
+    timer_options.stagger_triggers = true;
+    GlobalTimer<TestClock> timer{timer_options};
+    timer.SetTriggerTime(milliseconds{2}, [&log]() { log.Log("A"); });
+    action_graph::TriggerOptions options;
+    options.has_phase = true;
+    timer.SetTriggerTime(milliseconds{2}, [&log]() { log.Log("B"); }, options);
+
+    TestClock::advance_time(milliseconds{2});
+    timer.WaitOneCycle();
+  }
+  auto entries = log.GetLog();
+  std::sort(entries.begin(), entries.end());
+  EXPECT_EQ(entries, (std::vector<std::string>{"A", "B"}));
+}
+
+TEST_F(GlobalTimerTest, cancel_trigger) {
+  std::atomic<size_t> counter_one{0};
+  std::atomic<size_t> counter_two{0};
+  GlobalTimer<TestClock> timer{};
+  auto handle_one =
+      timer.SetTriggerTime(milliseconds{1}, [&counter_one]() { ++counter_one; });
+  timer.SetTriggerTime(milliseconds{1}, [&counter_two]() { ++counter_two; });
+
+  TestClock::advance_time(milliseconds{1});
+  timer.WaitOneCycle();
+  handle_one.Cancel();
+  for (int loop = 0; loop < 3; ++loop) {
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+
+  EXPECT_EQ(counter_one.load(), 1);
+  EXPECT_EQ(counter_two.load(), 4);
+  EXPECT_EQ(timer.GetTriggerStatistics().size(), 1);
+}
+
+TEST_F(GlobalTimerTest, add_trigger_after_cancel) {
+  std::atomic<size_t> counter{0};
+  GlobalTimer<TestClock> timer{};
+  auto handle = timer.SetTriggerTime(milliseconds{1}, []() {});
+  handle.Cancel();
+  TestClock::advance_time(milliseconds{1});
+  timer.WaitOneCycle();
+
+  timer.SetTriggerTime(milliseconds{2}, [&counter]() { ++counter; });
+  for (int loop = 0; loop < 4; ++loop) {
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+  EXPECT_EQ(counter.load(), 2);
+}
+
+TEST_F(GlobalTimerTest, change_period) {
+  std::vector<int> trigger_times;
+  {
+    GlobalTimer<TestClock> timer{};
+    auto handle = timer.SetTriggerTime(milliseconds{2}, [&trigger_times]() {
+      trigger_times.push_back(
+          static_cast<int>(TestClock::now().time_since_epoch().count()));
+    });
+    for (int loop = 1; loop <= 10; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+      if (loop == 4)
+        handle.ChangePeriod(milliseconds{3});
+    }
+  }
+  EXPECT_EQ(trigger_times, (std::vector<int>{2, 4, 7, 10}));
+}
+
+TEST_F(GlobalTimerTest, pause_and_resume) {
+  std::atomic<size_t> counter{0};
+  GlobalTimer<TestClock> timer{};
+  auto handle =
+      timer.SetTriggerTime(milliseconds{1}, [&counter]() { ++counter; });
+
+  handle.Pause();
+  EXPECT_TRUE(handle.IsPaused());
+  for (int loop = 0; loop < 3; ++loop) {
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+  EXPECT_EQ(counter.load(), 0);
+
+  handle.Resume();
+  for (int loop = 0; loop < 3; ++loop) {
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+  EXPECT_EQ(counter.load(), 3);
+  const auto statistics = handle.GetStatistics();
+  EXPECT_EQ(statistics.executed, 3);
+  EXPECT_EQ(statistics.dropped, 0);
+}
+
+TEST_F(GlobalTimerTest, invalid_trigger_handle) {
+  GlobalTimer<TestClock>::TriggerHandle empty_handle;
+  EXPECT_THROW(empty_handle.Pause(), std::logic_error);
+  EXPECT_THROW(empty_handle.Cancel(), std::logic_error);
+
+  GlobalTimer<TestClock> timer{};
+  EXPECT_THROW(timer.SetTriggerTime(milliseconds{0}, []() {}),
+               std::invalid_argument);
+  auto handle = timer.SetTriggerTime(milliseconds{1}, []() {});
+  EXPECT_THROW(handle.ChangePeriod(milliseconds{-1}), std::invalid_argument);
+}
+
+TEST_F(GlobalTimerTest, handle_outlives_timer) {
+  GlobalTimer<TestClock>::TriggerHandle handle;
+  {
+    GlobalTimer<TestClock> timer{};
+    handle = timer.SetTriggerTime(milliseconds{1}, []() {});
+  }
+  handle.ChangePeriod(milliseconds{2});
+  handle.Cancel();
+  EXPECT_EQ(handle.GetStatistics().executed, 0);
+}
+
+class CatchUpPolicyTest : public GlobalTimerTest {
+protected:
+  action_graph::TriggerStatistics FireAfterStall(
+      action_graph::CatchUpPolicy policy, std::size_t max_catch_up_fires = 1) {
+    GlobalTimer<TestClock> timer{};
+    action_graph::TriggerOptions options;
+    options.catch_up_policy = policy;
+    options.max_catch_up_fires = max_catch_up_fires;
+    options.overrun_policy = action_graph::OverrunPolicy::kRunConcurrently;
+    options.max_concurrent_executions = 10;
+    auto handle = timer.SetTriggerTime(milliseconds{1}, []() {}, options);
+
+    TestClock::advance_time(milliseconds{5});
+    for (int loop = 0; loop < 6; ++loop) {
+      timer.WaitOneCycle();
+    }
+    return handle.GetStatistics();
+  }
+};
+
+TEST_F(CatchUpPolicyTest, burst) {
+  const auto statistics = FireAfterStall(action_graph::CatchUpPolicy::kBurst);
+  EXPECT_EQ(statistics.executed, 5);
+  EXPECT_EQ(statistics.skipped, 0);
+}
+
+TEST_F(CatchUpPolicyTest, skip_to_now) {
+  const auto statistics =
+      FireAfterStall(action_graph::CatchUpPolicy::kSkipToNow);
+  EXPECT_EQ(statistics.executed, 1);
+  EXPECT_EQ(statistics.skipped, 4);
+}
+
+TEST_F(CatchUpPolicyTest, limited_burst) {
+  const auto statistics =
+      FireAfterStall(action_graph::CatchUpPolicy::kLimitedBurst, 2);
+  EXPECT_EQ(statistics.executed, 3);
+  EXPECT_EQ(statistics.skipped, 2);
+}
+
+TEST_F(CatchUpPolicyTest, keeps_deadlines_after_skipping) {
+  std::vector<int> trigger_times;
+  {
+    GlobalTimer<TestClock> timer{};
+    action_graph::TriggerOptions options;
+    options.catch_up_policy = action_graph::CatchUpPolicy::kSkipToNow;
+    timer.SetTriggerTime(
+        milliseconds{2},
+        [&trigger_times]() {
+          trigger_times.push_back(
+              static_cast<int>(TestClock::now().time_since_epoch().count()));
+        },
+        options);
+
+    TestClock::advance_time(milliseconds{7});
+    timer.WaitOneCycle();
+    for (int loop = 0; loop < 3; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+  }
+  EXPECT_EQ(trigger_times, (std::vector<int>{7, 8, 10}));
+}
+
+TEST_F(GlobalTimerTest, detect_stall) {
+  std::vector<std::chrono::nanoseconds> delays;
+  action_graph::GlobalTimerOptions options;
+  options.stall_threshold = milliseconds{100};
+  options.on_stall = [&delays](std::chrono::nanoseconds delay) {
+    delays.push_back(delay);
+  };
+  GlobalTimer<TestClock> timer{options};
+  timer.SetTriggerTime(milliseconds{10}, []() {});
+
+  TestClock::advance_time(milliseconds{10});
+  timer.WaitOneCycle();
+  EXPECT_EQ(timer.GetStallCount(), 0);
+
+  TestClock::advance_time(seconds{1});
+  timer.WaitOneCycle();
+  EXPECT_EQ(timer.GetStallCount(), 1);
+  ASSERT_EQ(delays.size(), 1);
+  EXPECT_EQ(delays.front(), milliseconds{990});
+}
+
+#ifdef __linux__
+TEST_F(GlobalTimerTest, dedicated_trigger_thread) {
+  std::mutex names_mutex;
+  std::set<std::string> names;
+  const auto record_name = [&names, &names_mutex]() {
+    char name[16]{};
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    std::lock_guard<std::mutex> lock(names_mutex);
+    names.insert(name);
+  };
+  {
+    action_graph::GlobalTimerOptions timer_options;
+    timer_options.worker_threads.name = "worker";
+    timer_options.worker_count = 1;
+    GlobalTimer<TestClock> timer{timer_options};
+    EXPECT_TRUE(timer.AreThreadsConfigured());
+    action_graph::TriggerOptions options;
+    options.has_dedicated_thread = true;
+    options.dedicated_thread.name = "sensor";
+    timer.SetTriggerTime(milliseconds{1}, record_name, options);
+    timer.SetTriggerTime(milliseconds{1}, record_name);
+
+    for (int loop = 0; loop < 3; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+  }
+  EXPECT_EQ(names, (std::set<std::string>{"sensor", "worker"}));
+}
+#endif
+
+TEST(GlobalTimer, sleep_then_spin) {
+  std::atomic<size_t> trigger_counter{0};
+  action_graph::GlobalTimerOptions options;
+  options.precision = action_graph::TimerPrecision::kSleepThenSpin;
+  GlobalTimer<std::chrono::steady_clock> timer{options};
+  timer.SetTriggerTime(milliseconds{1},
+                       [&trigger_counter]() { ++trigger_counter; });
+  std::this_thread::sleep_for(milliseconds{50});
+  timer.WaitOneCycle();
+
+  const auto statistics = timer.GetWakeUpStatistics();
+  EXPECT_GT(trigger_counter.load(), 10);
+  EXPECT_GT(statistics.count, 10);
+  EXPECT_GT(statistics.spin_slack, std::chrono::nanoseconds::zero());
+  EXPECT_LE(statistics.mean_error, statistics.max_error);
+}
+
+TEST(GlobalTimer, fixed_spin_slack) {
+  action_graph::GlobalTimerOptions options;
+  options.precision = action_graph::TimerPrecision::kSleepThenSpin;
+  options.spin_slack = std::chrono::microseconds{200};
+  GlobalTimer<std::chrono::steady_clock> timer{options};
+  timer.SetTriggerTime(milliseconds{1}, []() {});
+  timer.WaitOneCycle();
+  EXPECT_EQ(timer.GetWakeUpStatistics().spin_slack,
+            std::chrono::microseconds{200});
+}
+
+TEST(GlobalTimer, measure_sleep_overshoot) {
+  const auto overshoot = action_graph::MeasureSleepOvershoot();
+  EXPECT_GE(overshoot, std::chrono::nanoseconds::zero());
+  EXPECT_LT(overshoot, milliseconds{100});
+}
+
+TEST_F(GlobalTimerTest, instrumentation) {
+  action_graph::GlobalTimerOptions timer_options;
+  timer_options.trigger_histograms = true;
+  GlobalTimer<TestClock> timer{timer_options};
+  action_graph::TriggerOptions options;
+  options.name = "sensor";
+  timer.SetTriggerTime(
+      milliseconds{4},
+      []() { std::this_thread::sleep_for(milliseconds{1}); }, options);
+
+  // fires one millisecond late at 5, 9 and 13
+  TestClock::advance_time(milliseconds{1});
+  for (int loop = 0; loop < 3; ++loop) {
+    TestClock::advance_time(milliseconds{4});
+    timer.WaitOneCycle();
+  }
+
+  const auto instrumentation = timer.GetInstrumentation();
+  EXPECT_GE(instrumentation.loop_passes, 3);
+  EXPECT_GT(instrumentation.loop_passes_per_second, 0.0);
+  EXPECT_EQ(instrumentation.pass_duration.count, instrumentation.loop_passes);
+  ASSERT_EQ(instrumentation.triggers.size(), 1);
+  const auto &trigger = instrumentation.triggers.front();
+  EXPECT_EQ(trigger.name, "sensor");
+  EXPECT_EQ(trigger.statistics.executed, 3);
+  EXPECT_EQ(trigger.fire_lateness.count, 3);
+  EXPECT_EQ(trigger.fire_lateness.max, milliseconds{1});
+  EXPECT_EQ(trigger.run_time.count, 3);
+  EXPECT_GE(trigger.run_time.Percentile(50.0), milliseconds{1});
+}
+
+TEST_F(GlobalTimerTest, trigger_histograms_are_off_by_default) {
+  GlobalTimer<TestClock> timer{};
+  timer.SetTriggerTime(milliseconds{4}, []() {});
+
+  TestClock::advance_time(milliseconds{4});
+  timer.WaitOneCycle();
+
+  const auto instrumentation = timer.GetInstrumentation();
+  ASSERT_EQ(instrumentation.triggers.size(), 1);
+  EXPECT_EQ(instrumentation.triggers[0].statistics.executed, 1);
+  EXPECT_EQ(instrumentation.triggers[0].fire_lateness.count, 0);
+  EXPECT_EQ(instrumentation.triggers[0].run_time.count, 0);
+}
+
+TEST_F(GlobalTimerTest, count_deadline_misses) {
+  action_graph::TriggerOptions late_options;
+  late_options.deadline = milliseconds{1};
+  std::atomic<bool> is_first_execution{true};
+  GlobalTimer<TestClock> timer{};
+  auto late = timer.SetTriggerTime(
+      milliseconds{2},
+      [&is_first_execution]() {
+        if (is_first_execution.exchange(false))
+          TestClock::advance_time(milliseconds{2});
+      },
+      late_options);
+  auto in_time = timer.SetTriggerTime(milliseconds{2}, []() {});
+
+  TestClock::advance_time(milliseconds{2});
+  timer.WaitOneCycle();
+
+  EXPECT_EQ(late.GetStatistics().deadline_misses, 1);
+  EXPECT_EQ(in_time.GetStatistics().deadline_misses, 0);
+}
+
+TEST_F(GlobalTimerTest, earliest_deadline_first) {
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  const auto record = [&order, &order_mutex](std::string name) {
+    return [&order, &order_mutex, name]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(name);
+    };
+  };
+  action_graph::executors::ThreadPool pool{1};
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  pool.Post([released]() { released.wait(); });
+
+  action_graph::GlobalTimerOptions timer_options;
+  timer_options.dispatch_policy =
+      action_graph::DispatchPolicy::kEarliestDeadlineFirst;
+  GlobalTimer<TestClock> timer{pool, timer_options};
+  action_graph::TriggerOptions relaxed;
+  relaxed.deadline = milliseconds{10};
+  auto relaxed_trigger =
+      timer.SetTriggerTime(milliseconds{2}, record("relaxed"), relaxed);
+  action_graph::TriggerOptions urgent;
+  urgent.deadline = milliseconds{1};
+  auto urgent_trigger =
+      timer.SetTriggerTime(milliseconds{2}, record("urgent"), urgent);
+
+  TestClock::advance_time(milliseconds{2});
+  std::thread waiting([&timer]() { timer.WaitOneCycle(); });
+  while (relaxed_trigger.GetStatistics().executed == 0 ||
+         urgent_trigger.GetStatistics().executed == 0) {
+    std::this_thread::sleep_for(milliseconds{1});
+  }
+  release.set_value();
+  waiting.join();
+
+  EXPECT_EQ(order, (std::vector<std::string>{"urgent", "relaxed"}));
+}
+
+TEST_F(GlobalTimerTest, batch_triggers_with_tolerance) {
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  const auto record_thread = [&thread_ids, &thread_ids_mutex]() {
+    std::lock_guard<std::mutex> lock(thread_ids_mutex);
+    thread_ids.insert(std::this_thread::get_id());
+  };
+  GlobalTimer<TestClock> timer{4};
+  action_graph::TriggerOptions options;
+  options.tolerance = milliseconds{1};
+  std::vector<GlobalTimer<TestClock>::TriggerHandle> handles;
+  for (int index = 0; index < 3; ++index) {
+    handles.push_back(
+        timer.SetTriggerTime(milliseconds{2}, record_thread, options));
+  }
+
+  TestClock::advance_time(milliseconds{2});
+  timer.WaitOneCycle();
+
+  for (const auto &handle : handles) {
+    EXPECT_EQ(handle.GetStatistics().executed, 1);
+  }
+  EXPECT_EQ(thread_ids.size(), 1);
+}
+
+TEST(GlobalTimer, coalesce_wake_ups_within_tolerance) {
+  action_graph::GlobalTimerOptions timer_options;
+  timer_options.trigger_histograms = true;
+  GlobalTimer<std::chrono::steady_clock> timer{timer_options};
+  action_graph::TriggerOptions tolerant;
+  tolerant.tolerance = milliseconds{5};
+  auto tolerant_trigger =
+      timer.SetTriggerTime(milliseconds{10}, []() {}, tolerant);
+  action_graph::TriggerOptions shifted;
+  shifted.phase = milliseconds{3};
+  shifted.has_phase = true;
+  auto shifted_trigger =
+      timer.SetTriggerTime(milliseconds{10}, []() {}, shifted);
+
+  std::this_thread::sleep_for(milliseconds{205});
+  timer.WaitOneCycle();
+
+  const auto instrumentation = timer.GetInstrumentation();
+  const auto fires = tolerant_trigger.GetStatistics().executed +
+                     shifted_trigger.GetStatistics().executed;
+  EXPECT_GT(fires, 20);
+  EXPECT_LT(instrumentation.loop_passes, fires);
+  EXPECT_GE(instrumentation.triggers[0].fire_lateness.Percentile(50.0),
+            milliseconds{2});
+}
+
+TEST_F(GlobalTimerTest, executor_of_the_trigger) {
+  action_graph::executors::InlineExecutor timer_thread;
+  std::thread::id pool_thread;
+  std::thread::id own_thread;
+  {
+    GlobalTimer<TestClock> timer{1};
+    action_graph::TriggerOptions options;
+    options.executor = &timer_thread;
+    timer.SetTriggerTime(
+        milliseconds{1},
+        [&own_thread]() { own_thread = std::this_thread::get_id(); }, options);
+    timer.SetTriggerTime(milliseconds{1}, [&pool_thread]() {
+      pool_thread = std::this_thread::get_id();
+    });
+
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+  EXPECT_NE(own_thread, std::thread::id{});
+  EXPECT_NE(pool_thread, std::thread::id{});
+  EXPECT_NE(own_thread, pool_thread);
+}
+
+TEST_F(GlobalTimerTest, inline_executor) {
+  action_graph::executors::InlineExecutor executor;
+  std::set<std::thread::id> thread_ids;
+  {
+    GlobalTimer<TestClock> timer{executor};
+    for (int index = 0; index < 3; ++index) {
+      timer.SetTriggerTime(milliseconds{1}, [&thread_ids]() {
+        thread_ids.insert(std::this_thread::get_id());
+      });
+    }
+
+    TestClock::advance_time(milliseconds{1});
+    timer.WaitOneCycle();
+  }
+  EXPECT_EQ(thread_ids.size(), 1);
+  EXPECT_EQ(thread_ids.count(std::this_thread::get_id()), 0);
+}
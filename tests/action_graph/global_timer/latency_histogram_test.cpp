@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/latency_histogram.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+using action_graph::LatencyHistogram;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+
+TEST(LatencyHistogram, small_values_are_exact) {
+  for (std::uint64_t value = 0; value < 32; ++value) {
+    EXPECT_EQ(LatencyHistogram::BucketIndex(value), value);
+    EXPECT_EQ(LatencyHistogram::BucketUpperBound(value), value);
+  }
+}
+
+TEST(LatencyHistogram, buckets_cover_values_without_gaps) {
+  std::uint64_t value = 0;
+  for (std::size_t index = 0; index + 1 < LatencyHistogram::kBucketCount;
+       ++index) {
+    const auto upper_bound = LatencyHistogram::BucketUpperBound(index);
+    EXPECT_EQ(LatencyHistogram::BucketIndex(value), index);
+    EXPECT_EQ(LatencyHistogram::BucketIndex(upper_bound), index);
+    value = upper_bound + 1;
+  }
+  EXPECT_EQ(LatencyHistogram::BucketIndex(UINT64_MAX),
+            LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyHistogram, relative_error) {
+  for (std::uint64_t value = 16; value < 100000000; value = value * 3 + 1) {
+    const auto upper_bound = LatencyHistogram::BucketUpperBound(
+        LatencyHistogram::BucketIndex(value));
+    EXPECT_GE(upper_bound, value);
+    EXPECT_LE(static_cast<double>(upper_bound - value),
+              static_cast<double>(value) / LatencyHistogram::kSubBucketCount);
+  }
+}
+
+TEST(LatencyHistogram, snapshot) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Snapshot().Percentile(50.0), nanoseconds::zero());
+
+  for (int value = 1; value <= 100; ++value) {
+    histogram.Record(microseconds{value});
+  }
+  histogram.Record(nanoseconds{-5});
+
+  const auto snapshot = histogram.Snapshot();
+  EXPECT_EQ(snapshot.count, 101);
+  EXPECT_EQ(snapshot.max, microseconds{100});
+  EXPECT_EQ(snapshot.bucket_counts.front(), 1);
+  const auto median = snapshot.Percentile(50.0);
+  EXPECT_GE(median, microseconds{49});
+  EXPECT_LE(median, microseconds{53});
+  EXPECT_EQ(snapshot.Percentile(100.0), microseconds{100});
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/schedule.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "test_clock.h"
+
+using std::chrono::milliseconds;
+
+template <typename Schedule> class ScheduleTest : public ::testing::Test {
+protected:
+  using TimePoint = TestClock::time_point;
+  using Entry = typename Schedule::Entry;
+
+  static TimePoint At(int milliseconds_since_epoch) {
+    return TimePoint(milliseconds{milliseconds_since_epoch});
+  }
+
+  std::vector<std::size_t> FireDue(int now, int next_deadline) {
+    std::vector<std::size_t> fired;
+    schedule.FireDue(At(now), [&fired, next_deadline](Entry &entry) {
+      fired.push_back(entry.id);
+      entry.deadline = At(next_deadline);
+      return true;
+    });
+    return fired;
+  }
+
+  Schedule schedule{};
+};
+
+using ScheduleTypes =
+    ::testing::Types<action_graph::LinearSchedule<TestClock::time_point>,
+                     action_graph::HeapSchedule<TestClock::time_point>>;
+TYPED_TEST_SUITE(ScheduleTest, ScheduleTypes);
+
+TYPED_TEST(ScheduleTest, empty) {
+  EXPECT_TRUE(this->schedule.IsEmpty());
+  EXPECT_THROW(this->schedule.EarliestDeadline(), std::logic_error);
+}
+
+TYPED_TEST(ScheduleTest, earliest_deadline) {
+  this->schedule.Insert(0, this->At(5));
+  this->schedule.Insert(1, this->At(2));
+  this->schedule.Insert(2, this->At(9));
+  EXPECT_FALSE(this->schedule.IsEmpty());
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(2));
+}
+
+TYPED_TEST(ScheduleTest, fire_due) {
+  this->schedule.Insert(0, this->At(5));
+  this->schedule.Insert(1, this->At(2));
+  this->schedule.Insert(2, this->At(9));
+  this->schedule.Insert(3, this->At(5));
+
+  auto fired = this->FireDue(5, 12);
+  std::sort(fired.begin(), fired.end());
+  EXPECT_EQ(fired, (std::vector<std::size_t>{0, 1, 3}));
+  EXPECT_EQ(this->schedule.Size(), 4);
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(9));
+
+  EXPECT_EQ(this->FireDue(9, 20), std::vector<std::size_t>{2});
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(12));
+}
+
+TYPED_TEST(ScheduleTest, update_all) {
+  this->schedule.Insert(0, this->At(5));
+  this->schedule.Insert(1, this->At(2));
+  this->schedule.UpdateAll([this](typename TestFixture::Entry &entry) {
+    entry.deadline = this->At(10 - static_cast<int>(entry.id));
+  });
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(9));
+
+  EXPECT_EQ(this->FireDue(9, 20), std::vector<std::size_t>{1});
+}
+
+TYPED_TEST(ScheduleTest, update_one_entry) {
+  for (std::size_t id = 0; id < 8; ++id) {
+    this->schedule.Insert(id, this->At(10 + static_cast<int>(id)));
+  }
+  this->schedule.Update(5, this->At(3));
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(3));
+  this->schedule.Update(5, this->At(30));
+  this->schedule.Update(0, this->At(20));
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(11));
+  EXPECT_THROW(this->schedule.Update(8, this->At(1)), std::logic_error);
+
+  auto fired = this->FireDue(17, 40);
+  std::sort(fired.begin(), fired.end());
+  EXPECT_EQ(fired, (std::vector<std::size_t>{1, 2, 3, 4, 6, 7}));
+  EXPECT_EQ(this->schedule.EarliestDeadline(), this->At(20));
+}
+
+TYPED_TEST(ScheduleTest, fire_once_per_pass) {
+  this->schedule.Insert(0, this->At(1));
+  EXPECT_EQ(this->FireDue(5, 2), std::vector<std::size_t>{0});
+  EXPECT_EQ(this->FireDue(5, 3), std::vector<std::size_t>{0});
+}
+
+TYPED_TEST(ScheduleTest, remove_fired_entries) {
+  this->schedule.Insert(0, this->At(1));
+  this->schedule.Insert(1, this->At(2));
+  this->schedule.Insert(2, this->At(3));
+  this->schedule.FireDue(this->At(5), [this](typename TypeParam::Entry &entry) {
+    entry.deadline = this->At(10);
+    return entry.id != 1;
+  });
+  EXPECT_EQ(this->schedule.Size(), 2);
+  auto fired = this->FireDue(10, 20);
+  std::sort(fired.begin(), fired.end());
+  EXPECT_EQ(fired, (std::vector<std::size_t>{0, 2}));
+}
+
+TEST(HeapSchedule, fire_due_in_deadline_order) {
+  using Schedule = action_graph::HeapSchedule<TestClock::time_point>;
+  Schedule schedule;
+  schedule.Insert(0, TestClock::time_point(milliseconds{3}));
+  schedule.Insert(1, TestClock::time_point(milliseconds{1}));
+  schedule.Insert(2, TestClock::time_point(milliseconds{3}));
+  schedule.Insert(3, TestClock::time_point(milliseconds{2}));
+
+  std::vector<std::size_t> fired;
+  schedule.FireDue(TestClock::time_point(milliseconds{3}),
+                   [&fired](Schedule::Entry &entry) {
+                     fired.push_back(entry.id);
+                     entry.deadline += milliseconds{10};
+                     return true;
+                   });
+
+  EXPECT_EQ(fired, (std::vector<std::size_t>{1, 3, 0, 2}));
+}
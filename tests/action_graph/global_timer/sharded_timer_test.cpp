@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/sharded_timer.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#include "test_clock.h"
+
+using action_graph::ShardedTimer;
+using action_graph::ShardedTimerOptions;
+using action_graph::ShardingStrategy;
+using std::chrono::milliseconds;
+
+class ShardedTimerTest : public ::testing::Test {
+protected:
+  void SetUp() override { TestClock::reset(); }
+
+  void TearDown() override { TestClock::reset(); }
+};
+
+TEST_F(ShardedTimerTest, requires_shards) {
+  ShardedTimerOptions options;
+  options.shard_count = 0;
+  EXPECT_THROW(ShardedTimer<TestClock>{options}, std::invalid_argument);
+}
+
+TEST_F(ShardedTimerTest, triggers_on_all_shards) {
+  std::atomic<int> fast_counter{0};
+  std::atomic<int> slow_counter{0};
+  {
+    ShardedTimer<TestClock> timer{};
+    timer.SetTriggerTime(milliseconds{1}, [&fast_counter]() { ++fast_counter; });
+    timer.SetTriggerTime(milliseconds{2}, [&slow_counter]() { ++slow_counter; });
+    EXPECT_NE(timer.ShardIndex(milliseconds{1}, {}),
+              timer.ShardIndex(milliseconds{2}, {}));
+
+    for (int loop = 0; loop < 6; ++loop) {
+      TestClock::advance_time(milliseconds{1});
+      timer.WaitOneCycle();
+    }
+    EXPECT_EQ(timer.GetTriggerStatistics().size(), 2);
+  }
+  EXPECT_EQ(fast_counter.load(), 6);
+  EXPECT_EQ(slow_counter.load(), 3);
+}
+
+TEST_F(ShardedTimerTest, same_period_class_shares_shard) {
+  ShardedTimerOptions options;
+  options.shard_count = 4;
+  ShardedTimer<TestClock> timer{options};
+  EXPECT_EQ(timer.ShardCount(), 4);
+  EXPECT_EQ(timer.ShardIndex(milliseconds{5}, {}),
+            timer.ShardIndex(milliseconds{7}, {}));
+}
+
+TEST_F(ShardedTimerTest, distribute_by_hash) {
+  ShardedTimerOptions options;
+  options.shard_count = 3;
+  options.sharding_strategy = ShardingStrategy::kByHash;
+  ShardedTimer<TestClock> timer{options};
+
+  action_graph::TriggerOptions named;
+  named.name = "sensor";
+  const auto shard = timer.ShardIndex(milliseconds{1}, named);
+  EXPECT_EQ(timer.ShardIndex(milliseconds{7}, named), shard);
+
+  for (std::size_t index = 0; index < 3; ++index) {
+    EXPECT_EQ(timer.ShardIndex(milliseconds{1}, {}), index);
+    timer.SetTriggerTime(milliseconds{1}, []() {});
+  }
+  for (std::size_t index = 0; index < timer.ShardCount(); ++index) {
+    EXPECT_EQ(timer.GetShard(index).GetTriggerStatistics().size(), 1);
+  }
+}
@@ -0,0 +1,283 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/simulated_timer.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using action_graph::GlobalTimerOptions;
+using action_graph::TriggerOptions;
+using std::chrono::milliseconds;
+
+using SimulatedTimer = action_graph::SimulatedTimer<std::chrono::steady_clock>;
+
+namespace {
+milliseconds SinceEpoch(const SimulatedTimer &timer) {
+  return std::chrono::duration_cast<milliseconds>(
+      timer.Now().time_since_epoch());
+}
+
+TriggerOptions Named(std::string name) {
+  TriggerOptions options;
+  options.name = std::move(name);
+  return options;
+}
+} // namespace
+
+TEST(SimulatedTimer, fires_every_period) {
+  SimulatedTimer timer{};
+  int counter{0};
+  timer.SetTriggerTime(milliseconds{2}, [&counter]() { ++counter; });
+
+  timer.RunFor(milliseconds{9});
+
+  EXPECT_EQ(counter, 4);
+  EXPECT_EQ(SinceEpoch(timer), milliseconds{9});
+}
+
+TEST(SimulatedTimer, callbacks_see_the_virtual_time) {
+  SimulatedTimer timer{};
+  std::vector<std::pair<std::string, milliseconds>> fires;
+  timer.SetTriggerTime(milliseconds{2}, [&timer, &fires]() {
+    fires.emplace_back("fast", SinceEpoch(timer));
+  });
+  timer.SetTriggerTime(milliseconds{3}, [&timer, &fires]() {
+    fires.emplace_back("slow", SinceEpoch(timer));
+  });
+
+  timer.RunFor(milliseconds{6});
+
+  const std::vector<std::pair<std::string, milliseconds>> expected{
+      {"fast", milliseconds{2}},
+      {"slow", milliseconds{3}},
+      {"fast", milliseconds{4}},
+      {"fast", milliseconds{6}},
+      {"slow", milliseconds{6}}};
+  EXPECT_EQ(fires, expected);
+}
+
+TEST(SimulatedTimer, step_jumps_to_the_next_deadline) {
+  SimulatedTimer timer{};
+  EXPECT_FALSE(timer.Step());
+
+  timer.SetTriggerTime(milliseconds{5}, []() {});
+  timer.SetTriggerTime(milliseconds{3}, []() {});
+
+  EXPECT_TRUE(timer.Step());
+  EXPECT_EQ(SinceEpoch(timer), milliseconds{3});
+  EXPECT_TRUE(timer.Step());
+  EXPECT_EQ(SinceEpoch(timer), milliseconds{5});
+  EXPECT_TRUE(timer.Step());
+  EXPECT_EQ(SinceEpoch(timer), milliseconds{6});
+}
+
+TEST(SimulatedTimer, replays_hours_quickly) {
+  GlobalTimerOptions options;
+  options.trigger_histograms = true;
+  SimulatedTimer timer{options};
+  std::uint64_t counter{0};
+  timer.SetTriggerTime(milliseconds{10}, [&counter]() { ++counter; });
+  timer.SetTriggerTime(std::chrono::seconds{1}, []() {});
+
+  timer.RunFor(std::chrono::hours{1});
+
+  EXPECT_EQ(counter, 360000);
+  const auto instrumentation = timer.GetInstrumentation();
+  EXPECT_EQ(instrumentation.loop_passes, 360000);
+  EXPECT_DOUBLE_EQ(instrumentation.loop_passes_per_second, 100.0);
+  ASSERT_EQ(instrumentation.triggers.size(), 2);
+  EXPECT_EQ(instrumentation.triggers[1].run_time.count, 3600);
+}
+
+TEST(SimulatedTimer, staggers_triggers) {
+  GlobalTimerOptions options;
+  options.stagger_triggers = true;
+  SimulatedTimer timer{options};
+  std::vector<std::pair<std::string, milliseconds>> fires;
+  for (const auto *name : {"a", "b", "c"}) {
+    timer.SetTriggerTime(milliseconds{3}, [&timer, &fires, name]() {
+      fires.emplace_back(name, SinceEpoch(timer));
+    });
+  }
+
+  timer.RunFor(milliseconds{5});
+
+  const std::vector<std::pair<std::string, milliseconds>> expected{
+      {"a", milliseconds{3}}, {"b", milliseconds{4}}, {"c", milliseconds{5}}};
+  EXPECT_EQ(fires, expected);
+}
+
+TEST(SimulatedTimer, staggers_every_period_on_its_own) {
+  GlobalTimerOptions options;
+  options.stagger_triggers = true;
+  SimulatedTimer timer{options};
+  std::vector<std::pair<std::string, milliseconds>> fires;
+  const auto record = [&timer, &fires](const char *name) {
+    return [&timer, &fires, name]() {
+      fires.emplace_back(name, SinceEpoch(timer));
+    };
+  };
+  timer.SetTriggerTime(milliseconds{4}, record("a"));
+  timer.SetTriggerTime(milliseconds{6}, record("x"));
+  auto cancelled = timer.SetTriggerTime(milliseconds{4}, record("b"));
+  timer.SetTriggerTime(milliseconds{6}, record("y"));
+  cancelled.Cancel();
+  timer.SetTriggerTime(milliseconds{4}, record("c"));
+
+  timer.RunFor(milliseconds{10});
+
+  const std::vector<std::pair<std::string, milliseconds>> expected{
+      {"a", milliseconds{4}}, {"x", milliseconds{6}}, {"c", milliseconds{6}},
+      {"a", milliseconds{8}}, {"y", milliseconds{9}}, {"c", milliseconds{10}}};
+  EXPECT_EQ(fires, expected);
+}
+
+TEST(SimulatedTimer, cancel_and_pause) {
+  SimulatedTimer timer{};
+  auto cancelled = timer.SetTriggerTime(milliseconds{1}, []() {}, Named("a"));
+  auto paused = timer.SetTriggerTime(milliseconds{1}, []() {}, Named("b"));
+
+  timer.RunFor(milliseconds{2});
+  cancelled.Cancel();
+  paused.Pause();
+  timer.RunFor(milliseconds{2});
+  paused.Resume();
+  timer.RunFor(milliseconds{1});
+
+  EXPECT_EQ(cancelled.GetStatistics().executed, 2);
+  EXPECT_EQ(paused.GetStatistics().executed, 3);
+  const auto statistics = timer.GetTriggerStatistics();
+  ASSERT_EQ(statistics.size(), 1);
+  EXPECT_EQ(statistics[0].name, "b");
+}
+
+TEST(SimulatedTimer, callback_registers_trigger) {
+  SimulatedTimer timer{};
+  int counter{0};
+  SimulatedTimer::TriggerHandle registering;
+  registering = timer.SetTriggerTime(milliseconds{2}, [&]() {
+    timer.SetTriggerTime(milliseconds{1}, [&counter]() { ++counter; });
+    registering.Cancel();
+  });
+
+  timer.RunFor(milliseconds{5});
+
+  EXPECT_EQ(counter, 3);
+  EXPECT_EQ(registering.GetStatistics().executed, 1);
+}
+
+TEST(SimulatedTimer, changes_the_period) {
+  SimulatedTimer timer{};
+  std::vector<milliseconds> fires;
+  auto handle = timer.SetTriggerTime(milliseconds{2}, [&timer, &fires]() {
+    fires.push_back(SinceEpoch(timer));
+  });
+
+  timer.RunFor(milliseconds{5});
+  handle.ChangePeriod(milliseconds{3});
+  timer.RunFor(milliseconds{6});
+
+  const std::vector<milliseconds> expected{milliseconds{2}, milliseconds{4},
+                                           milliseconds{8}, milliseconds{11}};
+  EXPECT_EQ(fires, expected);
+}
+
+TEST(SimulatedTimer, callback_changes_its_period) {
+  SimulatedTimer timer{};
+  std::vector<milliseconds> fires;
+  SimulatedTimer::TriggerHandle handle;
+  handle = timer.SetTriggerTime(milliseconds{1}, [&]() {
+    fires.push_back(SinceEpoch(timer));
+    handle.ChangePeriod(milliseconds{4});
+  });
+
+  timer.RunFor(milliseconds{9});
+
+  const std::vector<milliseconds> expected{milliseconds{1}, milliseconds{5},
+                                           milliseconds{9}};
+  EXPECT_EQ(fires, expected);
+}
+
+TEST(SimulatedTimer, fires_within_the_tolerance_together) {
+  GlobalTimerOptions options;
+  options.trigger_histograms = true;
+  SimulatedTimer timer{options};
+  std::vector<std::pair<std::string, milliseconds>> fires;
+  TriggerOptions tolerant = Named("tolerant");
+  tolerant.tolerance = milliseconds{5};
+  timer.SetTriggerTime(
+      milliseconds{10},
+      [&timer, &fires]() { fires.emplace_back("tolerant", SinceEpoch(timer)); },
+      tolerant);
+  timer.SetTriggerTime(milliseconds{12}, [&timer, &fires]() {
+    fires.emplace_back("strict", SinceEpoch(timer));
+  });
+
+  timer.RunFor(milliseconds{12});
+
+  const std::vector<std::pair<std::string, milliseconds>> expected{
+      {"strict", milliseconds{12}}, {"tolerant", milliseconds{12}}};
+  EXPECT_EQ(fires, expected);
+  const auto instrumentation = timer.GetInstrumentation();
+  EXPECT_EQ(instrumentation.loop_passes, 1);
+  EXPECT_EQ(instrumentation.triggers[0].fire_lateness.max, milliseconds{2});
+}
+
+// Fires 5 milliseconds late, which one trigger tolerates and the other not.
+void ExpectDeadlineMissesWithinTolerance(SimulatedTimer &timer) {
+  TriggerOptions missing = Named("missing");
+  missing.tolerance = milliseconds{5};
+  missing.deadline = milliseconds{1};
+  TriggerOptions meeting = Named("meeting");
+  meeting.tolerance = milliseconds{5};
+  meeting.deadline = milliseconds{8};
+  timer.SetTriggerTime(milliseconds{10}, []() {}, missing);
+  timer.SetTriggerTime(milliseconds{10}, []() {}, meeting);
+
+  timer.RunFor(milliseconds{100});
+
+  const auto statistics = timer.GetTriggerStatistics();
+  ASSERT_EQ(statistics.size(), 2);
+  EXPECT_EQ(statistics[0].statistics.executed, 9);
+  EXPECT_EQ(statistics[0].statistics.deadline_misses, 9);
+  EXPECT_EQ(statistics[1].statistics.executed, 9);
+  EXPECT_EQ(statistics[1].statistics.deadline_misses, 0);
+}
+
+TEST(SimulatedTimer, counts_deadline_misses_inline) {
+  SimulatedTimer timer{};
+  ExpectDeadlineMissesWithinTolerance(timer);
+}
+
+TEST(SimulatedTimer, counts_deadline_misses_on_worker_pool) {
+  action_graph::executors::ThreadPool pool{2};
+  SimulatedTimer timer{pool};
+  ExpectDeadlineMissesWithinTolerance(timer);
+}
+
+TEST(SimulatedTimer, runs_on_worker_pool) {
+  action_graph::executors::ThreadPool pool{2};
+  std::atomic<int> counter{0};
+  {
+    SimulatedTimer timer{pool};
+    for (int index = 0; index < 4; ++index) {
+      timer.SetTriggerTime(milliseconds{1}, [&counter]() { ++counter; });
+    }
+    timer.RunFor(milliseconds{100});
+    EXPECT_EQ(counter.load(), 400);
+  }
+}
+
+TEST(SimulatedTimer, rejects_invalid_period) {
+  SimulatedTimer timer{};
+  EXPECT_THROW(timer.SetTriggerTime(milliseconds{0}, []() {}),
+               std::invalid_argument);
+}
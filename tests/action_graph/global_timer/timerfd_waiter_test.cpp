@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/timerfd_waiter.h>
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using action_graph::TimerFdWaiter;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+TEST(TimerFdWaiter, wakes_up_at_deadline) {
+  TimerFdWaiter waiter;
+  std::mutex mutex;
+  std::unique_lock<std::mutex> lock(mutex);
+  const auto start = steady_clock::now();
+  waiter.WaitUntil(lock, start + milliseconds{20}, []() { return false; });
+  const auto waited = steady_clock::now() - start;
+  EXPECT_GE(waited, milliseconds{20});
+  EXPECT_LT(waited, milliseconds{500});
+  EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(TimerFdWaiter, deadline_in_the_past) {
+  TimerFdWaiter waiter;
+  std::mutex mutex;
+  std::unique_lock<std::mutex> lock(mutex);
+  const auto start = steady_clock::now();
+  waiter.WaitUntil(lock, start - milliseconds{20}, []() { return false; });
+  EXPECT_LT(steady_clock::now() - start, milliseconds{500});
+}
+
+TEST(TimerFdWaiter, notify_wakes_up_waiting_thread) {
+  TimerFdWaiter waiter;
+  std::mutex mutex;
+  bool is_notified{false};
+  std::thread notifier([&]() {
+    std::this_thread::sleep_for(milliseconds{10});
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      is_notified = true;
+    }
+    waiter.NotifyAll();
+  });
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    waiter.Wait(lock, [&is_notified]() { return is_notified; });
+    EXPECT_TRUE(is_notified);
+  }
+  notifier.join();
+}
+
+TEST(TimerFdGlobalTimer, triggers_periodically) {
+  std::atomic<int> counter{0};
+  {
+    action_graph::TimerFdGlobalTimer<> timer{};
+    auto handle =
+        timer.SetTriggerTime(milliseconds{10}, [&counter]() { ++counter; });
+    std::this_thread::sleep_for(milliseconds{105});
+    timer.WaitOneCycle();
+    handle.Cancel();
+  }
+  EXPECT_GE(counter.load(), 5);
+  EXPECT_LE(counter.load(), 11);
+}
+
+#endif
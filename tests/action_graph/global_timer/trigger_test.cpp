@@ -3,12 +3,18 @@
 // This file is part of the action_graph library and is licensed under the MIT
 // License. See the LICENSE file in the root directory for full license text.
 
+#include <action_graph/executors/thread_pool.h>
 #include <action_graph/global_timer/trigger.h>
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <stdexcept>
+#include <thread>
 
 using std::chrono::milliseconds;
 using std::chrono::seconds;
@@ -99,3 +105,169 @@ TEST_F(TriggerTest, trigger_twice) {
   expected_log = {"running", "finished", "running", "finished"};
   EXPECT_EQ(log.GetLog(), expected_log);
 }
+
+class OverrunPolicyTest : public ::testing::Test {
+protected:
+  using OverrunPolicy = action_graph::OverrunPolicy;
+  using Trigger = action_graph::Trigger;
+
+  static std::chrono::nanoseconds Now() {
+    return std::chrono::nanoseconds{now.load()};
+  }
+
+  static action_graph::ExecutionDeadline Deadline(std::int64_t nanoseconds) {
+    action_graph::ExecutionDeadline deadline;
+    deadline.time_since_epoch = std::chrono::nanoseconds{nanoseconds};
+    deadline.now = &Now;
+    return deadline;
+  }
+
+  // Fires at the deadlines 10, 20 and 30 while the first execution runs and
+  // finishes all of them at 25.
+  action_graph::TriggerStatistics FireThreeTimesAndFinishAt25(
+      OverrunPolicy overrun_policy) {
+    action_graph::executors::ThreadPool pool{1};
+    Trigger trigger(BlockingCallback(), overrun_policy);
+    now = 0;
+    trigger.TriggerAsynchronously(pool, Deadline(10));
+    trigger.TriggerAsynchronously(pool, Deadline(20));
+    trigger.TriggerAsynchronously(pool, Deadline(30));
+    now = 25;
+    Release(trigger);
+    return trigger.GetStatistics();
+  }
+
+  std::function<void()> BlockingCallback() {
+    return [this]() {
+      ++started_executions;
+      while (!is_released.load()) {
+        std::this_thread::yield();
+      }
+    };
+  }
+
+  void Release(Trigger &trigger) {
+    is_released = true;
+    trigger.WaitUntilTriggerIsFinished();
+  }
+
+  static std::atomic<std::int64_t> now;
+  std::atomic<int> started_executions{0};
+  std::atomic<bool> is_released{false};
+};
+
+std::atomic<std::int64_t> OverrunPolicyTest::now{0};
+
+TEST_F(OverrunPolicyTest, skip_counts_dropped_fires) {
+  Trigger trigger(BlockingCallback());
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  Release(trigger);
+
+  const auto statistics = trigger.GetStatistics();
+  EXPECT_EQ(started_executions.load(), 1);
+  EXPECT_EQ(statistics.executed, 1);
+  EXPECT_EQ(statistics.dropped, 2);
+  EXPECT_EQ(statistics.coalesced, 0);
+}
+
+TEST_F(OverrunPolicyTest, queue_one_executes_one_pending_fire) {
+  Trigger trigger(BlockingCallback(), OverrunPolicy::kQueueOne);
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  Release(trigger);
+
+  const auto statistics = trigger.GetStatistics();
+  EXPECT_EQ(started_executions.load(), 2);
+  EXPECT_EQ(statistics.executed, 2);
+  EXPECT_EQ(statistics.dropped, 2);
+  EXPECT_EQ(statistics.coalesced, 0);
+}
+
+TEST_F(OverrunPolicyTest, coalesce_merges_pending_fires) {
+  Trigger trigger(BlockingCallback(), OverrunPolicy::kCoalesce);
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  trigger.TriggerAsynchronously();
+  Release(trigger);
+
+  const auto statistics = trigger.GetStatistics();
+  EXPECT_EQ(started_executions.load(), 2);
+  EXPECT_EQ(statistics.executed, 2);
+  EXPECT_EQ(statistics.dropped, 0);
+  EXPECT_EQ(statistics.coalesced, 2);
+}
+
+TEST_F(OverrunPolicyTest, queue_one_keeps_the_deadline_of_the_first_fire) {
+  const auto statistics =
+      FireThreeTimesAndFinishAt25(OverrunPolicy::kQueueOne);
+
+  EXPECT_EQ(statistics.executed, 2);
+  EXPECT_EQ(statistics.dropped, 1);
+  EXPECT_EQ(statistics.deadline_misses, 2);
+}
+
+TEST_F(OverrunPolicyTest, coalesce_takes_the_deadline_of_the_latest_fire) {
+  const auto statistics =
+      FireThreeTimesAndFinishAt25(OverrunPolicy::kCoalesce);
+
+  EXPECT_EQ(statistics.executed, 2);
+  EXPECT_EQ(statistics.coalesced, 1);
+  EXPECT_EQ(statistics.deadline_misses, 1);
+}
+
+TEST_F(OverrunPolicyTest, run_concurrently_up_to_limit) {
+  action_graph::executors::ThreadPool pool{3};
+  Trigger trigger(BlockingCallback(), OverrunPolicy::kRunConcurrently, 2);
+  trigger.TriggerAsynchronously(pool);
+  trigger.TriggerAsynchronously(pool);
+  trigger.TriggerAsynchronously(pool);
+  while (started_executions.load() < 2) {
+    std::this_thread::yield();
+  }
+  Release(trigger);
+
+  const auto statistics = trigger.GetStatistics();
+  EXPECT_EQ(started_executions.load(), 2);
+  EXPECT_EQ(statistics.executed, 2);
+  EXPECT_EQ(statistics.dropped, 1);
+}
+
+TEST_F(OverrunPolicyTest, requires_concurrent_executions) {
+  EXPECT_THROW(
+      Trigger(BlockingCallback(), OverrunPolicy::kRunConcurrently, 0),
+      std::invalid_argument);
+}
+
+TEST(Trigger, wait_until_finished_blocks_without_spinning) {
+  action_graph::Trigger trigger(
+      []() { std::this_thread::sleep_for(milliseconds{200}); });
+  trigger.TriggerAsynchronously();
+
+  const auto cpu_time_at_start = std::clock();
+  trigger.WaitUntilTriggerIsFinished();
+  const auto consumed_cpu_time =
+      static_cast<double>(std::clock() - cpu_time_at_start) / CLOCKS_PER_SEC;
+
+  EXPECT_EQ(trigger.GetStatistics().executed, 1);
+  EXPECT_LT(consumed_cpu_time, 0.05);
+}
+
+TEST(Trigger, trigger_synchronously_passes_on_exceptions) {
+  bool is_throwing{true};
+  action_graph::Trigger trigger([&is_throwing]() {
+    if (is_throwing)
+      throw std::runtime_error("failed");
+  });
+
+  EXPECT_THROW(trigger.TriggerSynchronously(), std::runtime_error);
+  is_throwing = false;
+  trigger.TriggerSynchronously();
+
+  EXPECT_EQ(trigger.GetStatistics().executed, 2);
+  trigger.WaitUntilTriggerIsFinished();
+}
@@ -7,10 +7,21 @@
 #define ACTION_GRAPH_TESTS_PARALLEL_ACTIONS_TEST_H_
 
 #include "executor_log.h"
+#include "failing_executor.h"
+#include <action_graph/executors/executor.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/executors/work_stealing_pool.h>
 #include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
 
 using action_graph::Action;
 using action_graph::ParallelActions;
@@ -65,4 +76,280 @@ TEST(ParallelActions, execute) {
   }
 }
 
+TEST(ParallelActions, execute_on_work_stealing_pool) {
+  ExecutorLog log;
+  std::vector<std::unique_ptr<Action>> actions;
+  for (const auto *name : {"action1", "action2", "action3"}) {
+    actions.push_back(std::make_unique<LoggingAction>(name, log));
+  }
+  action_graph::executors::WorkStealingPool pool{2};
+
+  action_graph::ParallelActions branches("test_sequence", std::move(actions),
+                                         pool);
+  branches.Execute();
+
+  auto entries = log.GetLog();
+  EXPECT_EQ(entries.size(), 6);
+  EXPECT_EQ(std::count_if(entries.begin(), entries.begin() + 3,
+                          [](const std::string &entry) {
+                            return entry.find("start: ") == 0;
+                          }),
+            3);
+}
+
+std::vector<std::unique_ptr<Action>>
+CountingActions(std::size_t count, std::atomic<std::size_t> &counter) {
+  std::vector<std::unique_ptr<Action>> actions;
+  for (std::size_t index = 0; index < count; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [&counter]() { ++counter; }));
+  }
+  return actions;
+}
+
+// Runs the same parallel actions on two threads at the same time, like a
+// trigger with the concurrent overrun policy.
+void ExecuteConcurrently(ParallelActions &branches, int executions) {
+  const auto execute = [&branches, executions]() {
+    for (int execution = 0; execution < executions; ++execution) {
+      branches.Execute();
+    }
+  };
+  std::thread other_thread(execute);
+  execute();
+  other_thread.join();
+}
+
+TEST(ParallelActions, concurrent_executions_on_executor) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::executors::ThreadPool pool{2};
+  ParallelActions branches("test_sequence", CountingActions(8, counter), pool);
+
+  ExecuteConcurrently(branches, 2000);
+
+  EXPECT_EQ(counter.load(), 2 * 2000 * 8);
+}
+
+TEST(ParallelActions, concurrent_executions_on_new_threads) {
+  std::atomic<std::size_t> counter{0};
+  ParallelActions branches("test_sequence", CountingActions(8, counter));
+  branches.SetMaxConcurrency(3);
+
+  ExecuteConcurrently(branches, 200);
+
+  EXPECT_EQ(counter.load(), 2 * 200 * 8);
+}
+
+TEST(ParallelActions, concurrent_executions_on_team) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::executors::WorkerTeamOptions options;
+  options.spin_duration = std::chrono::microseconds{10};
+  ParallelActions branches("test_sequence", CountingActions(4, counter),
+                           options);
+
+  ExecuteConcurrently(branches, 500);
+
+  EXPECT_EQ(counter.load(), 2 * 500 * 4);
+}
+
+TEST(ParallelActions, executing_thread_takes_part) {
+  action_graph::executors::InlineExecutor executor;
+  std::vector<std::unique_ptr<Action>> actions;
+  const auto caller = std::this_thread::get_id();
+  std::atomic<int> calls_on_caller{0};
+  for (int index = 0; index < 3; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [caller, &calls_on_caller]() {
+          if (std::this_thread::get_id() == caller)
+            ++calls_on_caller;
+        }));
+  }
+  ParallelActions branches("test_sequence", std::move(actions), executor);
+
+  branches.Execute();
+
+  EXPECT_EQ(calls_on_caller.load(), 3);
+}
+
+TEST(ParallelActions, nested_on_a_single_thread) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::executors::ThreadPool pool{1};
+  std::vector<std::unique_ptr<Action>> inner;
+  for (int index = 0; index < 3; ++index) {
+    inner.push_back(std::make_unique<ParallelActions>(
+        "inner", CountingActions(3, counter), pool));
+  }
+  ParallelActions outer("outer", std::move(inner), pool);
+
+  outer.Execute();
+  outer.Execute();
+
+  EXPECT_EQ(counter.load(), 18);
+}
+
+TEST(ParallelActions, rethrows_an_exception_of_a_child) {
+  action_graph::executors::ThreadPool pool{2};
+  std::atomic<std::size_t> counter{0};
+  auto actions = CountingActions(3, counter);
+  actions.push_back(std::make_unique<action_graph::SingleAction>(
+      "failing", []() { throw std::runtime_error("failed"); }));
+  ParallelActions branches("test_sequence", std::move(actions), pool);
+
+  EXPECT_THROW(branches.Execute(), std::runtime_error);
+  EXPECT_EQ(counter.load(), 3);
+  EXPECT_THROW(branches.Execute(), std::runtime_error);
+}
+
+// The helper, which was posted, may still run a child, when Execute throws.
+TEST(ParallelActions, passes_on_a_failed_post) {
+  action_graph::executors::ThreadPool pool{1};
+  FailingExecutor executor{pool, 1};
+  std::atomic<std::size_t> counter{0};
+  {
+    ParallelActions branches("test_sequence", CountingActions(8, counter),
+                             executor);
+    EXPECT_THROW(branches.Execute(), std::runtime_error);
+    EXPECT_THROW(branches.Execute(), std::runtime_error);
+  }
+  EXPECT_LE(counter.load(), 2 * 8);
+}
+
+TEST(ParallelActions, execute_on_team) {
+  std::atomic<std::size_t> counter{0};
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  std::vector<std::unique_ptr<Action>> actions;
+  for (int index = 0; index < 4; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [&counter, &thread_ids, &thread_ids_mutex]() {
+          ++counter;
+          std::lock_guard<std::mutex> lock(thread_ids_mutex);
+          thread_ids.insert(std::this_thread::get_id());
+        }));
+  }
+  ParallelActions branches("test_sequence", std::move(actions),
+                           action_graph::executors::WorkerTeamOptions{});
+
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    branches.Execute();
+  }
+
+  EXPECT_EQ(counter.load(), 40);
+  EXPECT_EQ(thread_ids.size(), 4);
+  EXPECT_EQ(thread_ids.count(std::this_thread::get_id()), 1);
+}
+
+TEST(ParallelActions, inline_execution_of_short_children) {
+  action_graph::executors::ThreadPool pool{2};
+  const auto caller = std::this_thread::get_id();
+  std::atomic<int> calls_on_caller{0};
+  std::vector<std::unique_ptr<Action>> actions;
+  for (int index = 0; index < 4; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [caller, &calls_on_caller]() {
+          if (std::this_thread::get_id() == caller)
+            ++calls_on_caller;
+        }));
+  }
+  ParallelActions branches("test_sequence", std::move(actions), pool);
+  action_graph::AdaptiveGranularity granularity;
+  granularity.threshold = std::chrono::milliseconds{100};
+  branches.SetAdaptiveGranularity(granularity);
+
+  // measures the children, which count as long before
+  branches.Execute();
+  auto statistics = branches.GetGranularityStatistics();
+  EXPECT_EQ(statistics.fan_out_executions, 1);
+  calls_on_caller = 0;
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    branches.Execute();
+  }
+
+  statistics = branches.GetGranularityStatistics();
+  EXPECT_EQ(statistics.inline_executions, 10);
+  EXPECT_EQ(statistics.group_count, 1);
+  EXPECT_EQ(calls_on_caller.load(), 40);
+  ASSERT_EQ(statistics.child_run_times.size(), 4);
+  for (const auto &run_time : statistics.child_run_times) {
+    EXPECT_GT(run_time, std::chrono::nanoseconds::zero());
+    EXPECT_LT(run_time, std::chrono::milliseconds{100});
+  }
+}
+
+TEST(ParallelActions, fan_out_of_long_children) {
+  ExecutorLog log;
+  std::vector<std::unique_ptr<Action>> actions;
+  for (const auto *name : {"action1", "action2", "action3"}) {
+    actions.push_back(std::make_unique<LoggingAction>(name, log));
+  }
+  ParallelActions branches("test_sequence", std::move(actions));
+  action_graph::AdaptiveGranularity granularity;
+  granularity.threshold = std::chrono::microseconds{100};
+  branches.SetAdaptiveGranularity(granularity);
+
+  branches.Execute();
+  branches.Execute();
+
+  const auto statistics = branches.GetGranularityStatistics();
+  EXPECT_EQ(statistics.fan_out_executions, 2);
+  EXPECT_EQ(statistics.group_count, 3);
+  for (const auto &run_time : statistics.child_run_times) {
+    EXPECT_GE(run_time, std::chrono::milliseconds{5});
+  }
+  EXPECT_THROW(branches.SetAdaptiveGranularity({granularity.threshold, 0.0}),
+               std::invalid_argument);
+}
+
+// The highest number of children, which ran at the same time.
+class ConcurrencyProbe {
+public:
+  std::vector<std::unique_ptr<Action>> CreateActions(std::size_t count) {
+    std::vector<std::unique_ptr<Action>> actions;
+    for (std::size_t index = 0; index < count; ++index) {
+      actions.push_back(std::make_unique<action_graph::SingleAction>(
+          "action", [this]() {
+            const auto running = ++running_;
+            auto highest = highest_.load();
+            while (running > highest &&
+                   !highest_.compare_exchange_weak(highest, running)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            --running_;
+          }));
+    }
+    return actions;
+  }
+
+  int Highest() const { return highest_.load(); }
+
+private:
+  std::atomic<int> running_{0};
+  std::atomic<int> highest_{0};
+};
+
+TEST(ParallelActions, max_concurrency_on_new_threads) {
+  ConcurrencyProbe probe;
+  ParallelActions branches("test_sequence", probe.CreateActions(20));
+  branches.SetMaxConcurrency(3);
+
+  branches.Execute();
+
+  EXPECT_LE(probe.Highest(), 3);
+  EXPECT_GE(probe.Highest(), 1);
+  EXPECT_THROW(branches.SetMaxConcurrency(0), std::invalid_argument);
+}
+
+TEST(ParallelActions, max_concurrency_on_executor) {
+  ConcurrencyProbe probe;
+  action_graph::executors::ThreadPool pool{8};
+  ParallelActions branches("test_sequence", probe.CreateActions(20), pool);
+  branches.SetMaxConcurrency(2);
+
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    branches.Execute();
+  }
+
+  EXPECT_LE(probe.Highest(), 2);
+}
+
 #endif // ACTION_GRAPH_TESTS_PARALLEL_ACTIONS_TEST_H_
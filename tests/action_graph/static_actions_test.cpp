@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include "failing_executor.h"
+#include <action_graph/action_sequence.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/static_actions.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using action_graph::MakeStaticAction;
+using action_graph::MakeStaticParallel;
+using action_graph::MakeStaticParallelOn;
+using action_graph::MakeStaticSequence;
+using action_graph::WrapStaticAction;
+
+TEST(StaticActions, sequence_runs_in_order) {
+  std::vector<int> calls;
+  auto sequence = MakeStaticSequence(
+      MakeStaticAction([&calls]() { calls.push_back(1); }),
+      MakeStaticSequence(MakeStaticAction([&calls]() { calls.push_back(2); }),
+                         MakeStaticAction([&calls]() { calls.push_back(3); })));
+
+  sequence.Execute();
+
+  EXPECT_EQ(calls, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(StaticActions, hold_children_by_value) {
+  auto sequence = MakeStaticSequence(MakeStaticAction([]() {}),
+                                     MakeStaticAction([]() {}));
+  static_assert(!std::is_polymorphic<decltype(sequence)>::value,
+                "A static sequence must not need virtual calls.");
+  EXPECT_LE(sizeof(sequence), sizeof(void *));
+}
+
+TEST(StaticActions, parallel_runs_every_child) {
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  auto parallel = MakeStaticParallel(MakeStaticAction(count),
+                                     MakeStaticAction(count),
+                                     MakeStaticAction(count));
+
+  parallel.Execute();
+
+  EXPECT_EQ(calls.load(), 3);
+}
+
+TEST(StaticActions, parallel_on_an_executor) {
+  action_graph::executors::ThreadPool pool{2};
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  auto parallel = MakeStaticParallelOn(
+      pool, MakeStaticAction(count),
+      MakeStaticSequence(MakeStaticAction(count), MakeStaticAction(count)));
+
+  for (int execution = 0; execution < 10; ++execution) {
+    parallel.Execute();
+  }
+
+  EXPECT_EQ(calls.load(), 30);
+}
+
+// Helpers of an execution may still be running, when the next one starts.
+TEST(StaticActions, parallel_executes_many_times) {
+  action_graph::executors::ThreadPool pool{2};
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  auto parallel =
+      MakeStaticParallelOn(pool, MakeStaticAction(count),
+                           MakeStaticAction(count), MakeStaticAction(count));
+
+  for (int execution = 0; execution < 200000; ++execution) {
+    parallel.Execute();
+  }
+
+  EXPECT_EQ(calls.load(), 600000);
+}
+
+TEST(StaticActions, parallel_rethrows_an_exception) {
+  action_graph::executors::InlineExecutor executor;
+  auto parallel = MakeStaticParallelOn(
+      executor, MakeStaticAction([]() {}),
+      MakeStaticAction([]() { throw std::runtime_error("failed"); }));
+
+  EXPECT_THROW(parallel.Execute(), std::runtime_error);
+}
+
+// Runs the same wrapped graph on two threads at the same time, like a
+// trigger with the concurrent overrun policy.
+TEST(StaticActions, parallel_executes_concurrently) {
+  action_graph::executors::ThreadPool pool{2};
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  auto wrapped = WrapStaticAction(
+      "static", MakeStaticParallelOn(pool, MakeStaticAction(count),
+                                     MakeStaticAction(count),
+                                     MakeStaticAction(count)));
+  const auto execute = [&wrapped]() {
+    for (int execution = 0; execution < 20000; ++execution) {
+      wrapped->Execute();
+    }
+  };
+
+  std::thread other_thread(execute);
+  execute();
+  other_thread.join();
+
+  EXPECT_EQ(calls.load(), 2 * 20000 * 3);
+}
+
+TEST(StaticActions, parallel_passes_on_a_failed_post) {
+  action_graph::executors::ThreadPool pool{1};
+  FailingExecutor executor{pool, 1};
+  std::atomic<int> calls{0};
+  const auto count = [&calls]() { ++calls; };
+  {
+    auto parallel = MakeStaticParallelOn(
+        executor, MakeStaticAction(count), MakeStaticAction(count),
+        MakeStaticAction(count), MakeStaticAction(count));
+    EXPECT_THROW(parallel.Execute(), std::runtime_error);
+    EXPECT_THROW(parallel.Execute(), std::runtime_error);
+  }
+  EXPECT_LE(calls.load(), 2 * 4);
+}
+
+TEST(StaticActions, wrapped_into_a_dynamic_graph) {
+  std::vector<std::string> calls;
+  auto wrapped = WrapStaticAction(
+      "static", MakeStaticSequence(
+                    MakeStaticAction([&calls]() { calls.push_back("a"); }),
+                    MakeStaticAction([&calls]() { calls.push_back("b"); })));
+  EXPECT_EQ(wrapped->name, "static");
+
+  action_graph::ActionSequence sequence("dynamic", std::move(wrapped));
+  sequence.Execute();
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"a", "b"}));
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+// Counts the heap allocations of all threads while it is set.
+std::atomic<bool> is_counting_allocations{false};
+std::atomic<std::size_t> allocation_count{0};
+} // namespace
+
+void *operator new(std::size_t size) {
+  if (is_counting_allocations)
+    ++allocation_count;
+  if (void *memory = std::malloc(size == 0 ? 1 : size))
+    return memory;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+
+using action_graph::Action;
+using action_graph::ParallelActions;
+
+namespace {
+std::vector<std::unique_ptr<Action>>
+CountingActions(std::size_t count, std::atomic<std::size_t> &counter) {
+  std::vector<std::unique_ptr<Action>> actions;
+  for (std::size_t index = 0; index < count; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [&counter]() { ++counter; }));
+  }
+  return actions;
+}
+} // namespace
+
+TEST(ParallelActions, execute_without_allocations) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::executors::ThreadPool pool{2};
+  ParallelActions branches("test_sequence", CountingActions(8, counter), pool);
+  // grows the queue of the pool
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    branches.Execute();
+  }
+
+  allocation_count = 0;
+  is_counting_allocations = true;
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    branches.Execute();
+  }
+  is_counting_allocations = false;
+
+  EXPECT_EQ(allocation_count.load(), 0);
+  EXPECT_EQ(counter.load(), 200 * 8);
+}
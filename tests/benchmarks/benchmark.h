@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+#ifndef TESTS_BENCHMARKS_BENCHMARK_H_
+#define TESTS_BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+template <typename Function>
+std::chrono::nanoseconds MeasureDuration(Function &&function) {
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+}
+
+inline double NanosecondsPerIteration(std::chrono::nanoseconds duration,
+                                      std::size_t iterations) {
+  return static_cast<double>(duration.count()) /
+         static_cast<double>(iterations);
+}
+
+inline void ReportMeasurement(const std::string &name, double value,
+                              const std::string &unit) {
+  std::cout << std::left << std::setw(48) << name << std::right
+            << std::setw(14) << std::fixed << std::setprecision(1) << value
+            << " " << unit << std::endl;
+}
+
+inline void ReportBenchmark(const std::string &name,
+                            double nanoseconds_per_iteration) {
+  ReportMeasurement(name, nanoseconds_per_iteration, "ns/iteration");
+}
+
+#endif // TESTS_BENCHMARKS_BENCHMARK_H_
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/action_sequence.h>
+#include <action_graph/compiler/execution_plan.h>
+#include <action_graph/compiler/plan_executor.h>
+#include <action_graph/single_action.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "benchmark.h"
+
+namespace {
+
+constexpr std::size_t kIterations = 200;
+constexpr std::size_t kTreeDepth = 10;
+
+// A balanced tree of sequences with 2^depth leaves.
+std::unique_ptr<action_graph::Action> SequenceTree(std::size_t depth,
+                                                   std::size_t &counter) {
+  if (depth == 0) {
+    return std::make_unique<action_graph::SingleAction>(
+        "leaf", [&counter]() { ++counter; });
+  }
+  return std::make_unique<action_graph::ActionSequence>(
+      "sequence", SequenceTree(depth - 1, counter),
+      SequenceTree(depth - 1, counter));
+}
+
+double TimePerExecution(action_graph::Action &action) {
+  const auto duration = MeasureDuration([&action]() {
+    for (std::size_t iteration = 0; iteration < kIterations; ++iteration) {
+      action.Execute();
+    }
+  });
+  return NanosecondsPerIteration(duration, kIterations);
+}
+
+} // namespace
+
+TEST(ExecutionPlanBenchmark, thousand_leaves_in_nested_sequences) {
+  std::size_t counter = 0;
+  auto tree = SequenceTree(kTreeDepth, counter);
+  action_graph::compiler::PlanExecutor plan{
+      action_graph::compiler::CompilePlan(SequenceTree(kTreeDepth, counter))};
+
+  const auto nested = TimePerExecution(*tree);
+  const auto flat = TimePerExecution(plan);
+  EXPECT_EQ(counter, 2 * kIterations * (std::size_t{1} << kTreeDepth));
+  EXPECT_EQ(plan.GetPlan().steps.size(), 1);
+  ReportBenchmark("ActionSequence tree (1024 leaves)", nested);
+  ReportBenchmark("Compiled plan (1024 leaves)", flat);
+}
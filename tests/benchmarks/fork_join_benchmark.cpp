@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/executors/work_stealing_pool.h>
+#include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+namespace {
+
+constexpr std::size_t kIterations = 200;
+
+std::vector<std::unique_ptr<action_graph::Action>>
+CountingActions(std::size_t count, std::atomic<std::size_t> &counter) {
+  std::vector<std::unique_ptr<action_graph::Action>> actions;
+  for (std::size_t index = 0; index < count; ++index) {
+    actions.push_back(std::make_unique<action_graph::SingleAction>(
+        "action", [&counter]() { ++counter; }));
+  }
+  return actions;
+}
+
+// The time of one Execute of a ParallelActions with trivial children.
+double TimePerForkJoin(action_graph::ParallelActions &parallel_actions) {
+  const auto duration = MeasureDuration([&parallel_actions]() {
+    for (std::size_t iteration = 0; iteration < kIterations; ++iteration) {
+      parallel_actions.Execute();
+    }
+  });
+  return NanosecondsPerIteration(duration, kIterations);
+}
+
+void CompareForkJoin(std::size_t child_count) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::ParallelActions thread_per_child(
+      "threads", CountingActions(child_count, counter));
+  action_graph::executors::WorkStealingPool pool{4};
+  action_graph::ParallelActions work_stealing(
+      "work_stealing", CountingActions(child_count, counter), pool);
+  action_graph::executors::ThreadPool thread_pool{4};
+  action_graph::ParallelActions fixed_pool(
+      "thread_pool", CountingActions(child_count, counter), thread_pool);
+
+  const auto threads = TimePerForkJoin(thread_per_child);
+  const auto stealing = TimePerForkJoin(work_stealing);
+  const auto fixed = TimePerForkJoin(fixed_pool);
+  EXPECT_EQ(counter.load(), 3 * kIterations * child_count);
+  const auto suffix = " (" + std::to_string(child_count) + " children)";
+  ReportBenchmark("ParallelActions thread per child" + suffix, threads);
+  ReportBenchmark("ParallelActions work stealing" + suffix, stealing);
+  ReportBenchmark("ParallelActions thread pool" + suffix, fixed);
+  ReportMeasurement("ParallelActions work stealing speedup" + suffix,
+                    threads / stealing, "x");
+}
+
+} // namespace
+
+TEST(ForkJoinBenchmark, four_children_on_team) {
+  std::atomic<std::size_t> counter{0};
+  action_graph::executors::ThreadPool thread_pool{4};
+  action_graph::ParallelActions fixed_pool(
+      "thread_pool", CountingActions(4, counter), thread_pool);
+  action_graph::ParallelActions team(
+      "team", CountingActions(4, counter),
+      action_graph::executors::WorkerTeamOptions{});
+
+  const auto fixed = TimePerForkJoin(fixed_pool);
+  const auto spinning = TimePerForkJoin(team);
+  EXPECT_EQ(counter.load(), 2 * kIterations * 4);
+  ReportBenchmark("ParallelActions thread pool (4 children)", fixed);
+  ReportBenchmark("ParallelActions team (4 children)", spinning);
+}
+
+TEST(ForkJoinBenchmark, eight_children) { CompareForkJoin(8); }
+
+TEST(ForkJoinBenchmark, hundred_children) { CompareForkJoin(100); }
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/schedule.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+using std::chrono::milliseconds;
+using TimePoint = std::chrono::steady_clock::time_point;
+
+namespace {
+
+constexpr std::size_t kTicks = 1000;
+
+milliseconds PeriodOf(std::size_t id) {
+  return milliseconds{100 + static_cast<int>((id * 7919) % 1000)};
+}
+
+// Simulates kTicks timer passes of one millisecond each and returns the
+// time spent per pass for finding, firing and rescheduling the due triggers.
+template <typename Schedule> double TimePerTick(std::size_t trigger_count) {
+  Schedule schedule;
+  const TimePoint start{};
+  for (std::size_t id = 0; id < trigger_count; ++id) {
+    schedule.Insert(id, start + PeriodOf(id));
+  }
+
+  std::size_t fired = 0;
+  const auto duration = MeasureDuration([&]() {
+    for (std::size_t tick = 1; tick <= kTicks; ++tick) {
+      const auto now = start + milliseconds{static_cast<int>(tick)};
+      schedule.FireDue(now, [&fired](typename Schedule::Entry &entry) {
+        ++fired;
+        entry.deadline += PeriodOf(entry.id);
+        return true;
+      });
+    }
+  });
+  EXPECT_GT(fired, 0);
+  return NanosecondsPerIteration(duration, kTicks);
+}
+
+void CompareSchedules(std::size_t trigger_count) {
+  using action_graph::HeapSchedule;
+  using action_graph::LinearSchedule;
+
+  const auto linear = TimePerTick<LinearSchedule<TimePoint>>(trigger_count);
+  const auto heap = TimePerTick<HeapSchedule<TimePoint>>(trigger_count);
+  const auto suffix = " (" + std::to_string(trigger_count) + " triggers)";
+  ReportBenchmark("LinearSchedule" + suffix, linear);
+  ReportBenchmark("HeapSchedule" + suffix, heap);
+  ReportMeasurement("HeapSchedule speedup" + suffix, linear / heap, "x");
+}
+
+} // namespace
+
+TEST(ScheduleBenchmark, ten_triggers) { CompareSchedules(10); }
+
+TEST(ScheduleBenchmark, thousand_triggers) { CompareSchedules(1000); }
+
+TEST(ScheduleBenchmark, hundred_thousand_triggers) {
+  CompareSchedules(100000);
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/action_sequence.h>
+#include <action_graph/executors/thread_pool.h>
+#include <action_graph/parallel_actions.h>
+#include <action_graph/single_action.h>
+#include <action_graph/static_actions.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+
+namespace {
+
+constexpr std::size_t kSequenceIterations = 100000;
+constexpr std::size_t kParallelIterations = 200;
+
+template <typename Graph>
+double TimePerExecution(Graph &graph, std::size_t iterations) {
+  const auto duration = MeasureDuration([&graph, iterations]() {
+    for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+      graph.Execute();
+    }
+  });
+  return NanosecondsPerIteration(duration, iterations);
+}
+
+} // namespace
+
+TEST(StaticActionsBenchmark, sequence_of_four_actions) {
+  std::atomic<std::size_t> counter{0};
+  const auto count = [&counter]() {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  };
+  action_graph::ActionSequence dynamic_sequence(
+      "dynamic", std::make_unique<action_graph::SingleAction>("a", count),
+      std::make_unique<action_graph::SingleAction>("b", count),
+      std::make_unique<action_graph::SingleAction>("c", count),
+      std::make_unique<action_graph::SingleAction>("d", count));
+  auto static_sequence = action_graph::MakeStaticSequence(
+      action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count));
+
+  const auto dynamic = TimePerExecution(dynamic_sequence, kSequenceIterations);
+  const auto fixed = TimePerExecution(static_sequence, kSequenceIterations);
+  EXPECT_EQ(counter.load(), 2 * 4 * kSequenceIterations);
+  ReportBenchmark("ActionSequence (4 actions)", dynamic);
+  ReportBenchmark("StaticSequence (4 actions)", fixed);
+}
+
+TEST(StaticActionsBenchmark, parallel_of_four_actions) {
+  std::atomic<std::size_t> counter{0};
+  const auto count = [&counter]() { ++counter; };
+  action_graph::executors::ThreadPool pool{4};
+  std::vector<std::unique_ptr<action_graph::Action>> actions;
+  for (std::size_t action = 0; action < 4; ++action) {
+    actions.push_back(
+        std::make_unique<action_graph::SingleAction>("action", count));
+  }
+  action_graph::ParallelActions dynamic_parallel("dynamic", std::move(actions),
+                                                 pool);
+  auto static_parallel = action_graph::MakeStaticParallelOn(
+      pool, action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count),
+      action_graph::MakeStaticAction(count));
+
+  const auto dynamic = TimePerExecution(dynamic_parallel, kParallelIterations);
+  const auto fixed = TimePerExecution(static_parallel, kParallelIterations);
+  EXPECT_EQ(counter.load(), 2 * 4 * kParallelIterations);
+  ReportBenchmark("ParallelActions thread pool (4 actions)", dynamic);
+  ReportBenchmark("StaticParallel thread pool (4 actions)", fixed);
+}
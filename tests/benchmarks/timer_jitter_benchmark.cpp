@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Daniel Dube
+//
+// This file is part of the action_graph library and is licensed under the MIT
+// License. See the LICENSE file in the root directory for full license text.
+
+#include <action_graph/global_timer/global_timer.h>
+#include <action_graph/global_timer/timerfd_waiter.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+constexpr milliseconds kPeriod{1};
+constexpr std::size_t kFires = 500;
+
+// Runs a trigger with a period of one millisecond and reports how late the
+// timer thread wakes up and how much the intervals between the executions
+// deviate from the period.
+template <typename Timer>
+void MeasureJitter(const std::string &name,
+                   action_graph::GlobalTimerOptions options = {}) {
+  std::mutex mutex;
+  std::vector<steady_clock::time_point> fire_times;
+  fire_times.reserve(kFires);
+  {
+    Timer timer{options};
+    timer.SetTriggerTime(kPeriod, [&mutex, &fire_times]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (fire_times.size() < kFires)
+        fire_times.push_back(steady_clock::now());
+    });
+    std::this_thread::sleep_for(kPeriod * (kFires + 20));
+    const auto wake_up = timer.GetWakeUpStatistics();
+    ReportMeasurement(name + " mean wake-up error",
+                      static_cast<double>(wake_up.mean_error.count()) / 1000.0,
+                      "us");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_GT(fire_times.size(), 2);
+  double total_deviation = 0.0;
+  double maximum_deviation = 0.0;
+  for (std::size_t index = 1; index < fire_times.size(); ++index) {
+    const auto interval = fire_times[index] - fire_times[index - 1];
+    const auto deviation = std::abs(
+        std::chrono::duration<double, std::micro>(interval - kPeriod).count());
+    total_deviation += deviation;
+    maximum_deviation = std::max(maximum_deviation, deviation);
+  }
+  ReportMeasurement(name + " mean jitter",
+                    total_deviation / static_cast<double>(fire_times.size() - 1),
+                    "us");
+  ReportMeasurement(name + " max jitter", maximum_deviation, "us");
+}
+
+} // namespace
+
+TEST(TimerJitterBenchmark, condition_variable) {
+  MeasureJitter<action_graph::GlobalTimer<steady_clock>>("condition_variable");
+}
+
+TEST(TimerJitterBenchmark, sleep_then_spin) {
+  action_graph::GlobalTimerOptions options;
+  options.precision = action_graph::TimerPrecision::kSleepThenSpin;
+  MeasureJitter<action_graph::GlobalTimer<steady_clock>>("sleep_then_spin",
+                                                          options);
+}
+
+#ifdef __linux__
+TEST(TimerJitterBenchmark, timerfd) {
+  MeasureJitter<action_graph::TimerFdGlobalTimer<>>("timerfd");
+}
+#endif
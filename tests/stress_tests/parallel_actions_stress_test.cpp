@@ -3,6 +3,7 @@
 // This file is part of the action_graph library and is licensed under the MIT
 // License. See the LICENSE file in the root directory for full license text.
 
+#include <action_graph/executors/work_stealing_pool.h>
 #include <action_graph/parallel_actions.h>
 #include <action_graph/single_action.h>
 #include <algorithm>
@@ -26,6 +27,36 @@ TEST(ParallelActionsStressTest, many_actions) {
   EXPECT_EQ(counter.load(), kActionsCount);
 }
 
+TEST(ParallelActionsStressTest, many_actions_on_work_stealing_pool) {
+  constexpr std::size_t kActionsCount = 1000;
+  std::vector<std::unique_ptr<Action>> actions;
+  actions.reserve(kActionsCount);
+  std::atomic<std::size_t> counter{0};
+  std::generate_n(std::back_inserter(actions), kActionsCount, [&counter]() {
+    return std::make_unique<SingleAction>("action",
+                                          [&counter]() { ++counter; });
+  });
+  action_graph::executors::WorkStealingPool pool{4};
+  action_graph::ParallelActions sequence("sequence", std::move(actions), pool);
+  sequence.Execute();
+  EXPECT_EQ(counter.load(), kActionsCount);
+}
+
+TEST(ParallelActionsStressTest, many_actions_with_max_concurrency) {
+  constexpr std::size_t kActionsCount = 1000;
+  std::vector<std::unique_ptr<Action>> actions;
+  actions.reserve(kActionsCount);
+  std::atomic<std::size_t> counter{0};
+  std::generate_n(std::back_inserter(actions), kActionsCount, [&counter]() {
+    return std::make_unique<SingleAction>("action",
+                                          [&counter]() { ++counter; });
+  });
+  action_graph::ParallelActions sequence("sequence", std::move(actions));
+  sequence.SetMaxConcurrency(8);
+  sequence.Execute();
+  EXPECT_EQ(counter.load(), kActionsCount);
+}
+
 TEST(ParallelActionsPerformance, many_iterations) {
   constexpr std::size_t kIterationCount = 1000;
   std::atomic<std::size_t> counter{0};